@@ -0,0 +1,131 @@
+#include "asset-loader.hh"
+
+#include <algorithm>
+#include <set>
+#include <stdexcept>
+
+// Decoding is mostly waiting on zlib; a few threads are plenty for
+// the number of assets we have.
+const int MAX_WORKERS = 4;
+
+AssetLoader::AssetLoader(SDL_Window *window, const vector<AssetEntry> &assets) :
+  stopping(false),
+  finished(0)
+{
+  int winw, winh;
+  SDL_GetWindowSize(window, &winw, &winh);
+
+  vector<int> windowHeights = {winh};
+  SDL_DisplayMode mode;
+  if (SDL_GetDesktopDisplayMode(SDL_GetWindowDisplayIndex(window), &mode) == 0 && mode.h != winh)
+    windowHeights.push_back(mode.h);
+
+  set<pair<FontId, int>> fontSizes;
+  for (auto &asset : assets) {
+    if (asset.type == AssetType::FONT) {
+      for (auto h : windowHeights)
+        fontSizes.insert(make_pair((FontId) asset.id, ResourceCache::GetFontSize(asset.height * h)));
+    }
+    else if ((asset.type == AssetType::TEXTURE && !ResourceCache::HasTexture((TextureId) asset.id)) ||
+             (asset.type == AssetType::SOUND && !ResourceCache::HasSound((SoundId) asset.id)))
+      this->pending.push_back(asset);
+  }
+
+  this->fontSizes.assign(fontSizes.begin(), fontSizes.end());
+  this->total = this->pending.size() + this->fontSizes.size();
+
+  int count = min(MAX_WORKERS, max(1, SDL_GetCPUCount() - 1));
+  count = min(count, (int) this->pending.size());
+  for (int i = 0; i < count; ++i)
+    this->workers.push_back(thread(&AssetLoader::Run, this));
+}
+
+AssetLoader::~AssetLoader() {
+  {
+    lock_guard<mutex> lock(this->queueMutex);
+    this->stopping = true;
+  }
+
+  for (auto &worker : this->workers)
+    worker.join();
+
+  // Free whatever was decoded but not added to the cache.
+  for (auto &result : this->decoded) {
+    Images::Free(result.image);
+    if (result.sound)
+      Mix_FreeChunk(result.sound);
+  }
+}
+
+void AssetLoader::Run() {
+  // Everything to decode is queued before the workers start, so they
+  // are done once the queue is empty.
+  for (;;) {
+    unique_lock<mutex> lock(this->queueMutex);
+    if (this->stopping || this->pending.empty())
+      return;
+
+    AssetEntry entry = this->pending.front();
+    this->pending.pop_front();
+    lock.unlock();
+
+    Result result = {entry, {0, 0, 0, nullptr, false}, nullptr, ""};
+    try {
+      if (entry.type == AssetType::TEXTURE)
+        result.image = ResourceCache::DecodeTexture((TextureId) entry.id);
+      else
+        result.sound = ResourceCache::DecodeSound((SoundId) entry.id);
+    }
+    catch (runtime_error &e) {
+      result.error = e.what();
+    }
+
+    lock.lock();
+    this->decoded.push_back(result);
+  }
+}
+
+void AssetLoader::Update(float budget) {
+  Uint64 start = SDL_GetPerformanceCounter();
+  Uint64 budgetTicks = budget * SDL_GetPerformanceFrequency();
+
+  do {
+    Result result;
+    bool haveResult = false;
+    {
+      lock_guard<mutex> lock(this->queueMutex);
+      if (!this->decoded.empty()) {
+        result = this->decoded.front();
+        this->decoded.pop_front();
+        haveResult = true;
+      }
+    }
+
+    if (haveResult) {
+      if (!result.error.empty())
+        throw runtime_error(result.error);
+
+      if (result.entry.type == AssetType::TEXTURE)
+        ResourceCache::UploadTexture((TextureId) result.entry.id, result.image);
+      else
+        ResourceCache::AddSound((SoundId) result.entry.id, result.sound);
+    }
+    else if (!this->fontSizes.empty()) {
+      // Font atlases are rendered and uploaded in one go, so they are
+      // done here, while the workers are busy decoding.
+      ResourceCache::GetFontAtlas(this->fontSizes.back().first, this->fontSizes.back().second);
+      this->fontSizes.pop_back();
+    }
+    else
+      break;
+
+    this->finished++;
+  } while (SDL_GetPerformanceCounter() - start < budgetTicks);
+
+  if (this->IsDone())
+    ResourceCache::preloadDone = true;
+}
+
+float AssetLoader::GetProgress() const {
+  return this->total > 0 ? (float) this->finished / this->total : 1.0f;
+}
@@ -0,0 +1,68 @@
+#ifndef _GRAVITY_ASSET_LOADER_HH_
+#define _GRAVITY_ASSET_LOADER_HH_
+
+#include "asset-manifest.hh"
+#include "resource-cache.hh"
+
+#include <SDL2/SDL.h>
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/// Loads a list of assets into the resource cache in the background.
+/// Images and sounds are decoded on worker threads. Everything that
+/// needs the OpenGL context, i.e. texture uploads and font atlases, is
+/// done on the main thread in Update, a little every frame, so that
+/// the screen keeps being drawn while loading.
+class AssetLoader {
+protected:
+  // A decoded asset waiting to be added to the cache, or the reason it
+  // could not be decoded.
+  struct Result {
+    AssetEntry entry;
+    TextureImage image;
+    Mix_Chunk *sound;
+    string error;
+  };
+
+  vector<thread> workers;
+  deque<AssetEntry> pending;
+  deque<Result> decoded;
+  bool stopping;
+  mutex queueMutex;
+
+  // Font atlases to create, by font and size.
+  vector<pair<FontId, int>> fontSizes;
+
+  int total;
+  int finished;
+
+  void Run();
+
+public:
+  /// Starts loading `assets`. Fonts are loaded at the sizes needed for
+  /// the current size of the window, and for the desktop size so that
+  /// switching to full screen does not need new ones either.
+  AssetLoader(SDL_Window *window, const vector<AssetEntry> &assets);
+
+  /// Stops the workers. Assets not loaded by then are not loaded.
+  ~AssetLoader();
+
+  /// Adds decoded assets to the cache until `budget` seconds have
+  /// passed, always adding at least one if any is ready. Must be
+  /// called on the main thread. Throws a runtime_error if an asset
+  /// could not be loaded.
+  void Update(float budget);
+
+  /// Returns the ratio of assets loaded so far.
+  float GetProgress() const;
+
+  bool IsDone() const { return this->finished == this->total; }
+};
+
+#endif /* _GRAVITY_ASSET_LOADER_HH_ */
@@ -0,0 +1,105 @@
+#include "asset-manifest.hh"
+
+#include <set>
+#include <tuple>
+
+bool AssetEntry::operator<(const AssetEntry &rhs) const {
+  return tie(this->type, this->id, this->height) < tie(rhs.type, rhs.id, rhs.height);
+}
+
+namespace AssetManifest {
+
+// Anything a screen loads, directly or through its widgets and
+// entities, should be listed here, so that it is loaded while the
+// splash screen is shown rather than on first use.
+const map<string, vector<AssetEntry>> screens = {
+  {"splash", {
+    AssetEntry::Texture(TextureId::SPLASH_DARK),
+    AssetEntry::Font(FontId::KENVECTOR_FUTURE, 0.05),
+  }},
+
+  {"main-menu", {
+    AssetEntry::Texture(TextureId::BACKGROUND_DARK),
+    AssetEntry::Texture(TextureId::SPLASH),
+    AssetEntry::Texture(TextureId::NEW_GAME),
+    AssetEntry::Texture(TextureId::HIGH_SCORES),
+    AssetEntry::Texture(TextureId::EXIT),
+    AssetEntry::Texture(TextureId::MUTE),
+    AssetEntry::Texture(TextureId::UNMUTE),
+    AssetEntry::Texture(TextureId::CREDITS_BUTTON),
+    AssetEntry::Sound(SoundId::CLICK),
+    AssetEntry::Sound(SoundId::HOVER),
+  }},
+
+  {"game", {
+    AssetEntry::Texture(TextureId::BACKGROUND_DARK),
+    AssetEntry::Texture(TextureId::CONTINUE),
+    AssetEntry::Texture(TextureId::PAUSE),
+    AssetEntry::Texture(TextureId::END_GAME),
+    AssetEntry::Texture(TextureId::MUTE),
+    AssetEntry::Texture(TextureId::UNMUTE),
+    AssetEntry::Texture(TextureId::GAME_OVER),
+    AssetEntry::Texture(TextureId::DIGITS),
+    AssetEntry::Texture(TextureId::LIVES0),
+    AssetEntry::Texture(TextureId::LIVES1),
+    AssetEntry::Texture(TextureId::LIVES2),
+    AssetEntry::Texture(TextureId::LIVES3),
+    AssetEntry::Texture(TextureId::ENEMY),
+    AssetEntry::Texture(TextureId::PLUS_SCORE),
+    AssetEntry::Texture(TextureId::MINUS_SCORE),
+    AssetEntry::Texture(TextureId::PLUS_TIME),
+    AssetEntry::Texture(TextureId::MINUS_TIME),
+    AssetEntry::Texture(TextureId::PLUS_PLANET),
+    AssetEntry::Sound(SoundId::BROWN),
+    AssetEntry::Sound(SoundId::CLICK),
+    AssetEntry::Sound(SoundId::HOVER),
+    AssetEntry::Sound(SoundId::SCORE_TIK),
+    AssetEntry::Sound(SoundId::ENEMY_COLLISION),
+    AssetEntry::Sound(SoundId::PLANET_SUN_COLLISION),
+    AssetEntry::Sound(SoundId::SUN_POWERUP),
+    AssetEntry::Sound(SoundId::PLANET_POWERUP),
+    AssetEntry::Font(FontId::KENVECTOR_FUTURE, 0.1),
+  }},
+
+  {"high-scores", {
+    AssetEntry::Texture(TextureId::BACKGROUND_DARK),
+    AssetEntry::Texture(TextureId::MAIN_MENU),
+    AssetEntry::Texture(TextureId::HIGH_SCORES),
+    AssetEntry::Texture(TextureId::DIGITS),
+    AssetEntry::Sound(SoundId::CLICK),
+    AssetEntry::Sound(SoundId::HOVER),
+  }},
+
+  {"credits", {
+    AssetEntry::Texture(TextureId::BACKGROUND_DARK),
+    AssetEntry::Texture(TextureId::MAIN_MENU),
+    AssetEntry::Texture(TextureId::CREDITS),
+    AssetEntry::Sound(SoundId::CLICK),
+    AssetEntry::Sound(SoundId::HOVER),
+  }},
+};
+
+const map<TextureId, TextureVariant> textureVariants = {
+  // Backgrounds are drawn at half brightness, so that the game objects
+  // and the HUD stand out.
+  {TextureId::BACKGROUND_DARK, {"background", {TextureTransform::Brightness(0.5f)}}},
+  {TextureId::SPLASH_DARK, {"splash", {TextureTransform::Brightness(0.5f)}}},
+};
+
+TextureVariant GetTextureVariant(TextureId id) {
+  auto it = textureVariants.find(id);
+  if (it != textureVariants.end())
+    return it->second;
+
+  return {GetResourceName(id), {}};
+}
+
+vector<AssetEntry> GetAll() {
+  set<AssetEntry> all;
+  for (auto &screen : screens)
+    all.insert(screen.second.begin(), screen.second.end());
+
+  return vector<AssetEntry>(all.begin(), all.end());
+}
+
+} // namespace AssetManifest
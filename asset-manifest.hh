@@ -0,0 +1,59 @@
+#ifndef _GRAVITY_ASSET_MANIFEST_HH_
+#define _GRAVITY_ASSET_MANIFEST_HH_
+
+#include "image.hh"
+#include "resource-ids.hh"
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+enum class AssetType {
+  TEXTURE,
+  SOUND,
+  FONT
+};
+
+/// An asset needed by a screen. `id` is a TextureId, SoundId or FontId
+/// depending on the type; fonts also come with the height of the text
+/// as a ratio of the window height, the way label widgets size their
+/// text.
+struct AssetEntry {
+  AssetType type;
+  int id;
+  float height;
+
+  static AssetEntry Texture(TextureId id) { return {AssetType::TEXTURE, (int) id, 0.0f}; }
+  static AssetEntry Sound(SoundId id) { return {AssetType::SOUND, (int) id, 0.0f}; }
+  static AssetEntry Font(FontId id, float height) { return {AssetType::FONT, (int) id, height}; }
+
+  bool operator<(const AssetEntry &rhs) const;
+};
+
+/// How a texture is made from an image file.
+struct TextureVariant {
+  string image;
+  vector<TextureTransform> transforms;
+};
+
+namespace AssetManifest {
+
+/// The assets each screen needs, by screen name.
+extern const map<string, vector<AssetEntry>> screens;
+
+/// Returns the assets of all screens, without duplicates.
+extern vector<AssetEntry> GetAll();
+
+/// Textures made from an image file with a different name, or with
+/// transforms applied at load time.
+extern const map<TextureId, TextureVariant> textureVariants;
+
+/// Returns how to make a texture. Textures not listed in
+/// textureVariants are the image file of the same name, unchanged.
+extern TextureVariant GetTextureVariant(TextureId id);
+
+} // namespace AssetManifest
+
+#endif /* _GRAVITY_ASSET_MANIFEST_HH_ */
@@ -0,0 +1,203 @@
+#include "asset-pack.hh"
+#include "platform.hh"
+#include "image.hh"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+// The layout of a pack file is:
+//
+//   header: magic (8 bytes), version (u32), entry count (u32),
+//           index offset (u64)
+//   data:   the entries, each aligned to DATA_ALIGNMENT bytes
+//   index:  per entry: type, width, height, levels (u32 each), offset,
+//           size (u64 each), name length (u32) and the name
+//
+// All numbers are little-endian, which is what every platform we build
+// for uses, so they are read and written as is.
+const char PACK_MAGIC[8] = {'G', 'R', 'A', 'V', 'P', 'A', 'C', 'K'};
+const uint32_t PACK_VERSION = 1;
+const size_t HEADER_SIZE = 24;
+const size_t DATA_ALIGNMENT = 16;
+
+// Cooked textures are never larger than this on either side.
+const uint32_t MAX_TEXTURE_SIZE = 1 << 15;
+
+template <typename T>
+bool ReadValue(const uint8_t *data, size_t size, size_t &pos, T &value) {
+  // Written so that a bogus position from the file cannot wrap around.
+  if (pos > size || sizeof(T) > size - pos)
+    return false;
+
+  memcpy(&value, data + pos, sizeof(T));
+  pos += sizeof(T);
+  return true;
+}
+
+template <typename T>
+void WriteValue(ostream &stream, T value) {
+  stream.write((const char*) &value, sizeof(T));
+}
+
+// Textures are uploaded level by level straight from the mapped data,
+// so the size has to match the dimensions exactly.
+bool IsValidTexture(const PackEntry &entry) {
+  if (entry.width == 0 || entry.width > MAX_TEXTURE_SIZE ||
+      entry.height == 0 || entry.height > MAX_TEXTURE_SIZE)
+    return false;
+
+  int maxLevels = Images::GetMipLevelCount(entry.width, entry.height);
+  if (entry.levels == 0 || entry.levels > (uint32_t) maxLevels)
+    return false;
+
+  return entry.size == Images::GetLevelOffset(entry.width, entry.height, entry.levels);
+}
+
+AssetPack::AssetPack() :
+  data(nullptr),
+  size(0)
+{
+}
+
+AssetPack::~AssetPack() {
+  if (this->data)
+    UnmapFile(this->data, this->size);
+}
+
+bool AssetPack::Open(const string &filename) {
+  this->data = (const uint8_t*) MapFile(filename, this->size);
+  if (this->data == nullptr)
+    return false;
+
+  size_t pos = sizeof(PACK_MAGIC);
+  uint32_t version, count;
+  uint64_t indexOffset;
+  if (this->size < HEADER_SIZE || memcmp(this->data, PACK_MAGIC, sizeof(PACK_MAGIC)) != 0 ||
+      !ReadValue(this->data, this->size, pos, version) || version != PACK_VERSION ||
+      !ReadValue(this->data, this->size, pos, count) ||
+      !ReadValue(this->data, this->size, pos, indexOffset))
+  {
+    cout << filename << " is not a valid pack file." << endl;
+    UnmapFile(this->data, this->size);
+    this->data = nullptr;
+    return false;
+  }
+
+  pos = indexOffset;
+  for (uint32_t i = 0; i < count; ++i) {
+    PackEntry entry;
+    uint32_t type, nameLength;
+    bool ok =
+      ReadValue(this->data, this->size, pos, type) &&
+      ReadValue(this->data, this->size, pos, entry.width) &&
+      ReadValue(this->data, this->size, pos, entry.height) &&
+      ReadValue(this->data, this->size, pos, entry.levels) &&
+      ReadValue(this->data, this->size, pos, entry.offset) &&
+      ReadValue(this->data, this->size, pos, entry.size) &&
+      ReadValue(this->data, this->size, pos, nameLength) &&
+      nameLength <= this->size - pos &&
+      entry.size <= this->size && entry.offset <= this->size - entry.size &&
+      (type == (uint32_t) PackEntryType::FILE ||
+       (type == (uint32_t) PackEntryType::TEXTURE && IsValidTexture(entry)));
+
+    if (!ok) {
+      cout << filename << " is corrupt." << endl;
+      this->entries.clear();
+      UnmapFile(this->data, this->size);
+      this->data = nullptr;
+      return false;
+    }
+
+    entry.type = (PackEntryType) type;
+    string name((const char*) this->data + pos, nameLength);
+    pos += nameLength;
+
+    this->entries[name] = entry;
+  }
+
+  return true;
+}
+
+const PackEntry *AssetPack::Find(const string &name) const {
+  auto it = this->entries.find(name);
+  if (it == this->entries.end())
+    return nullptr;
+
+  return &it->second;
+}
+
+void AssetPackWriter::AddFile(const string &name, const string &contents) {
+  Item item;
+  item.name = name;
+  item.entry = {PackEntryType::FILE, 0, contents.size(), 0, 0, 0};
+  item.data.assign(contents.begin(), contents.end());
+  this->items.push_back(item);
+}
+
+void AssetPackWriter::AddTexture(const string &name, const TextureImage &image) {
+  size_t size = Images::GetLevelOffset(image.width, image.height, image.levels);
+
+  Item item;
+  item.name = name;
+  item.entry = {PackEntryType::TEXTURE, 0, size,
+                (uint32_t) image.width, (uint32_t) image.height, (uint32_t) image.levels};
+  item.data.assign(image.pixels, image.pixels + size);
+  this->items.push_back(item);
+}
+
+void AssetPackWriter::Write(const string &filename) const {
+  // Write to a temporary file first, so that a failed cook never
+  // leaves a truncated pack behind.
+  string tmpFilename = filename + ".tmp";
+  ofstream stream(tmpFilename, ofstream::out | ofstream::binary);
+  if (!stream) {
+    stringstream ss;
+    ss << "Could not open " << tmpFilename << " for writing.";
+    throw runtime_error(ss.str());
+  }
+
+  // Leave room for the header, which needs the index offset.
+  stream.write(PACK_MAGIC, sizeof(PACK_MAGIC));
+  stream.write(string(HEADER_SIZE - sizeof(PACK_MAGIC), '\0').data(), HEADER_SIZE - sizeof(PACK_MAGIC));
+
+  vector<uint64_t> offsets;
+  uint64_t pos = HEADER_SIZE;
+  for (auto &item : this->items) {
+    uint64_t padding = (DATA_ALIGNMENT - pos % DATA_ALIGNMENT) % DATA_ALIGNMENT;
+    stream.write(string(padding, '\0').data(), padding);
+    pos += padding;
+
+    offsets.push_back(pos);
+    stream.write((const char*) item.data.data(), item.data.size());
+    pos += item.data.size();
+  }
+
+  uint64_t indexOffset = pos;
+  for (size_t i = 0; i < this->items.size(); ++i) {
+    const Item &item = this->items[i];
+    WriteValue<uint32_t>(stream, (uint32_t) item.entry.type);
+    WriteValue<uint32_t>(stream, item.entry.width);
+    WriteValue<uint32_t>(stream, item.entry.height);
+    WriteValue<uint32_t>(stream, item.entry.levels);
+    WriteValue<uint64_t>(stream, offsets[i]);
+    WriteValue<uint64_t>(stream, item.data.size());
+    WriteValue<uint32_t>(stream, item.name.size());
+    stream.write(item.name.data(), item.name.size());
+  }
+
+  stream.seekp(sizeof(PACK_MAGIC));
+  WriteValue<uint32_t>(stream, PACK_VERSION);
+  WriteValue<uint32_t>(stream, this->items.size());
+  WriteValue<uint64_t>(stream, indexOffset);
+
+  stream.close();
+  if (!stream || rename(tmpFilename.data(), filename.data()) != 0) {
+    remove(tmpFilename.data());
+    stringstream ss;
+    ss << "Could not write " << filename << ".";
+    throw runtime_error(ss.str());
+  }
+}
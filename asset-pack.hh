@@ -0,0 +1,77 @@
+#ifndef _GRAVITY_ASSET_PACK_HH_
+#define _GRAVITY_ASSET_PACK_HH_
+
+#include "image.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+enum class PackEntryType : uint32_t {
+  FILE = 0,    // the contents of a resource file, as is
+  TEXTURE = 1  // a decoded RGBA texture with its full mip chain
+};
+
+struct PackEntry {
+  PackEntryType type;
+  uint64_t offset;
+  uint64_t size;
+
+  // Only for textures.
+  uint32_t width;
+  uint32_t height;
+  uint32_t levels;
+};
+
+/// A pack of resources cooked ahead of time by gravity-cook. The pack
+/// is memory mapped, so nothing is read until it is used, and entries
+/// can be used straight from the mapping.
+///
+/// Entries are named after their path in the resources directory,
+/// e.g. "shaders/hud-vertex-shader.glsl", except for textures, which
+/// are named "textures/" followed by the texture name.
+class AssetPack {
+protected:
+  const uint8_t *data;
+  size_t size;
+  map<string, PackEntry> entries;
+
+public:
+  AssetPack();
+  ~AssetPack();
+
+  /// Maps a pack file. Returns false if it does not exist or is not a
+  /// valid pack.
+  bool Open(const string &filename);
+
+  /// Returns the entry with the given name, or nullptr if there is
+  /// none.
+  const PackEntry *Find(const string &name) const;
+
+  const uint8_t *GetData(const PackEntry &entry) const { return this->data + entry.offset; }
+};
+
+/// Builds a pack file; used by gravity-cook.
+class AssetPackWriter {
+protected:
+  struct Item {
+    string name;
+    PackEntry entry;
+    vector<uint8_t> data;
+  };
+
+  vector<Item> items;
+
+public:
+  void AddFile(const string &name, const string &contents);
+  void AddTexture(const string &name, const TextureImage &image);
+
+  /// Writes the pack. Throws a runtime_error on failure.
+  void Write(const string &filename) const;
+};
+
+#endif /* _GRAVITY_ASSET_PACK_HH_ */
@@ -1,11 +1,7 @@
 #include "button-widget.hh"
 #include "screen.hh"
-#include "helpers.hh"
 
 void ButtonWidget::HandleEvent(const SDL_Event &e) {
-  int mousex, mousey;
-  float xp, yp;
-
   switch (e.type) {
   case SDL_MOUSEBUTTONDOWN:
     this->mouseDown = this->isActive;
@@ -20,24 +16,8 @@ void ButtonWidget::HandleEvent(const SDL_Event &e) {
     break;
 
   case SDL_MOUSEMOTION:
-    SDL_GetMouseState(&mousex, &mousey);
-    GetRelativeCoords(mousex, mousey, this->screen->window, this->xanchor, this->yanchor, xp, yp);
-
-    bool xInRange = false;
-    bool yInRange = false;
-
-    if (this->xanchor == TextAnchor::CENTER)
-      xInRange = xp >= (this->x - this->width / 2.0) && xp <= (this->x + this->width / 2.0);
-    else
-      xInRange = xp >= this->x && xp <= (this->x + this->width);
-
-    if (this->yanchor == TextAnchor::CENTER)
-      yInRange = yp >= (this->y - this->height / 2.0) && yp <= (this->y + this->height / 2.0);
-    else
-      yInRange = yp >= this->y && yp <= (this->y + this->height);
-
     bool prevIsActive = this->isActive;
-    this->isActive = xInRange && yInRange;
+    this->isActive = this->screen->hud.HitTest(this->rect, e.motion.x, e.motion.y);
 
     if (this->isActive)
       this->SetColor(this->activeColor);
@@ -59,10 +39,6 @@ void ButtonWidget::Advance(float dt) {
   this->LabelWidget::Advance(dt);
 }
 
-void ButtonWidget::Render(Renderer *renderer) {
-  this->LabelWidget::Render(renderer);
-}
-
 void ButtonWidget::Reset() {
   this->isActive = false;
   this->SetColor(this->inactiveColor);
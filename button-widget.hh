@@ -40,7 +40,6 @@ public:
 
   virtual void HandleEvent(const SDL_Event &e);
   virtual void Advance(float dt);
-  virtual void Render(Renderer *renderer);
   virtual void Reset();
 };
 
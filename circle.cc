@@ -0,0 +1,100 @@
+#include "circle.hh"
+#include "resource-cache.hh"
+#include "gl-diagnostics.hh"
+
+#include <cstddef>
+
+CircleBatch::CircleBatch() {
+  // The corners of a quad covering the circle, in units of the
+  // circle's (glow-extended) radius.
+  const GLfloat quadData[] = {
+    // triangle 1
+    -1.0f, -1.0f,
+    -1.0f,  1.0f,
+     1.0f, -1.0f,
+
+    // triangle 2
+    -1.0f,  1.0f,
+     1.0f,  1.0f,
+     1.0f, -1.0f,
+  };
+
+  glGenBuffers(1, &this->quadVbo);
+
+  glBindBuffer(GL_ARRAY_BUFFER, this->quadVbo);
+  glBufferData(GL_ARRAY_BUFFER, 6 * 2 * sizeof(GLfloat), quadData, GL_STATIC_DRAW);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  glGenBuffers(1, &this->instanceVbo);
+}
+
+CircleBatch::~CircleBatch() {
+  glDeleteBuffers(1, &this->quadVbo);
+  glDeleteBuffers(1, &this->instanceVbo);
+}
+
+void CircleBatch::Clear() {
+  this->instances.clear();
+}
+
+void CircleBatch::Add(const b2Vec2 &center, float32 radius, const CircleStyle &style, float alpha) {
+  this->instances.push_back({
+      {center.x, center.y},
+      radius,
+      style.ring,
+      style.glow,
+      style.softness,
+      {style.fill[0], style.fill[1], style.fill[2], style.fill[3] * alpha},
+      {style.edge[0], style.edge[1], style.edge[2], style.edge[3] * alpha}});
+}
+
+void CircleBatch::Draw() {
+  if (this->instances.empty())
+    return;
+
+  GLuint program = ResourceCache::circleProgram;
+  glUseProgram(program);
+
+  glBindBuffer(GL_ARRAY_BUFFER, this->instanceVbo);
+  glBufferData(GL_ARRAY_BUFFER, this->instances.size() * sizeof(CircleInstance), this->instances.data(), GL_STREAM_DRAW);
+
+  GLint cornerAttr = glGetAttribLocation(program, "corner");
+  GLint centerAttr = glGetAttribLocation(program, "center");
+  GLint radiusAttr = glGetAttribLocation(program, "radius");
+  GLint ringAttr = glGetAttribLocation(program, "ring");
+  GLint glowAttr = glGetAttribLocation(program, "glow");
+  GLint softnessAttr = glGetAttribLocation(program, "softness");
+  GLint fillAttr = glGetAttribLocation(program, "fill_color");
+  GLint edgeAttr = glGetAttribLocation(program, "edge_color");
+
+  const GLint instanceAttrs[] = {centerAttr, radiusAttr, ringAttr, glowAttr, softnessAttr, fillAttr, edgeAttr};
+  for (auto attr : instanceAttrs) {
+    glEnableVertexAttribArray(attr);
+    glVertexAttribDivisor(attr, 1);
+  }
+
+  GLsizei stride = sizeof(CircleInstance);
+  glVertexAttribPointer(centerAttr, 2, GL_FLOAT, GL_FALSE, stride, (void*) offsetof(CircleInstance, center));
+  glVertexAttribPointer(radiusAttr, 1, GL_FLOAT, GL_FALSE, stride, (void*) offsetof(CircleInstance, radius));
+  glVertexAttribPointer(ringAttr, 1, GL_FLOAT, GL_FALSE, stride, (void*) offsetof(CircleInstance, ring));
+  glVertexAttribPointer(glowAttr, 1, GL_FLOAT, GL_FALSE, stride, (void*) offsetof(CircleInstance, glow));
+  glVertexAttribPointer(softnessAttr, 1, GL_FLOAT, GL_FALSE, stride, (void*) offsetof(CircleInstance, softness));
+  glVertexAttribPointer(fillAttr, 4, GL_FLOAT, GL_FALSE, stride, (void*) offsetof(CircleInstance, fill));
+  glVertexAttribPointer(edgeAttr, 4, GL_FLOAT, GL_FALSE, stride, (void*) offsetof(CircleInstance, edge));
+
+  glBindBuffer(GL_ARRAY_BUFFER, this->quadVbo);
+  glEnableVertexAttribArray(cornerAttr);
+  glVertexAttribPointer(cornerAttr, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(GLfloat), (void*) 0);
+
+  glDrawArraysInstanced(GL_TRIANGLES, 0, 6, this->instances.size());
+  GL_CHECK("circle");
+
+  for (auto attr : instanceAttrs) {
+    glVertexAttribDivisor(attr, 0);
+    glDisableVertexAttribArray(attr);
+  }
+  glDisableVertexAttribArray(cornerAttr);
+
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glUseProgram(0);
+}
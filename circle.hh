@@ -0,0 +1,67 @@
+#ifndef _GRAVITY_CIRCLE_HH_
+#define _GRAVITY_CIRCLE_HH_
+
+#include "gl-loader.hh"
+#include <Box2D/Box2D.h>
+
+#include <vector>
+
+using namespace std;
+
+/// Describes how a procedural circle looks. Circles are drawn
+/// analytically from their signed distance field, so they need no
+/// texture and stay sharp at any zoom level.
+struct CircleStyle {
+  /// Color of the disk.
+  GLfloat fill[4];
+
+  /// Color of the ring at the edge of the disk and of the glow.
+  GLfloat edge[4];
+
+  /// Width of the edge ring, as a fraction of the radius. The disk
+  /// color blends smoothly into the edge color across the ring. Zero
+  /// means no ring.
+  GLfloat ring;
+
+  /// How far the glow extends beyond the disk, as a fraction of the
+  /// radius. Zero means no glow.
+  GLfloat glow;
+
+  /// Width of the faded border of the disk, as a fraction of the
+  /// radius. Zero gives a crisp, antialiased border.
+  GLfloat softness;
+};
+
+/// Per-instance data for circle-vertex-shader.glsl.
+struct CircleInstance {
+  GLfloat center[2];
+  GLfloat radius;
+  GLfloat ring;
+  GLfloat glow;
+  GLfloat softness;
+  GLfloat fill[4];
+  GLfloat edge[4];
+};
+
+/// Collects the circles drawn in a frame and draws them all with a
+/// single instanced call, in the order they were added.
+class CircleBatch {
+protected:
+  GLuint quadVbo;
+  GLuint instanceVbo;
+  vector<CircleInstance> instances;
+
+public:
+  CircleBatch();
+  ~CircleBatch();
+
+  void Clear();
+
+  /// Adds a circle. The alpha of both colors in the style is
+  /// multiplied by `alpha`.
+  void Add(const b2Vec2 &center, float32 radius, const CircleStyle &style, float alpha=1.0f);
+
+  void Draw();
+};
+
+#endif /* _GRAVITY_CIRCLE_HH_ */
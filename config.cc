@@ -2,11 +2,24 @@
 
 const bool Config::HardwareAcceleration = true;
 const bool Config::VSync = true;
+const bool Config::AdaptiveVSync = true;
 const int Config::HighScores = 5;
 const float Config::PhysicsTimeStep = 0.005;
+const int Config::MaxPhysicsStepsPerFrame = 40;
+const float Config::MinTimeScale = 0.25;
+const float Config::MaxTimeScale = 64.0;
 const int Config::ScreenWidth = 640;
 const int Config::ScreenHeight = 480;
-const int Config::TimeStep = 5;
+const int Config::FrameRate = 200;
+const int Config::RecordingFrameRate = 60;
+const int Config::IdleTimeout = 500;
+const float Config::LoadingFrameBudget = 0.008;
+const int Config::TextureCacheSize = 256 * 1024 * 1024;
+const int Config::SoundCacheSize = 64 * 1024 * 1024;
+const int Config::FontCacheSize = 16 * 1024 * 1024;
+const bool Config::DynamicResolution = true;
+const float Config::MinRenderScale = 0.5;
+const char *Config::ScreenshotDirectory = "gravity-screenshots";
 const int Config::GameTime = 120;
 const float Config::CameraMinWidth = 150.0;
 const float Config::CameraMinHeight = 75.0;
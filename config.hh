@@ -5,11 +5,24 @@ class Config {
 public:
   static const bool HardwareAcceleration;
   static const bool VSync;
+  static const bool AdaptiveVSync;
   static const int HighScores;
   static const float PhysicsTimeStep;
+  static const int MaxPhysicsStepsPerFrame;
+  static const float MinTimeScale;
+  static const float MaxTimeScale;
   static const int ScreenWidth;
   static const int ScreenHeight;
-  static const int TimeStep;
+  static const int FrameRate;
+  static const int RecordingFrameRate;
+  static const int IdleTimeout;
+  static const float LoadingFrameBudget;
+  static const int TextureCacheSize;
+  static const int SoundCacheSize;
+  static const int FontCacheSize;
+  static const bool DynamicResolution;
+  static const float MinRenderScale;
+  static const char *ScreenshotDirectory;
   static const int GameTime;
   static const float CameraMinWidth;
   static const float CameraMinHeight;
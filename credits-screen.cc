@@ -4,16 +4,16 @@
 
 CreditsScreen::CreditsScreen(SDL_Window *window) :
   Screen(window),
-  background(window, ResourceCache::GetTexture("background"))
+  background(window, ResourceCache::GetTexture(TextureId::BACKGROUND_DARK))
 {
   this->widgets.push_back(new ImageButtonWidget(this,
-                                                ResourceCache::GetTexture("main-menu"),
+                                                ResourceCache::GetTexture(TextureId::MAIN_MENU),
                                                 0.02, 0.02, 0.05,
                                                 TextAnchor::RIGHT, TextAnchor::BOTTOM,
                                                 {255, 0, 0, 200},
                                                 {255, 255, 255, 200}));
   this->widgets.push_back(new ImageWidget(this,
-                                          ResourceCache::GetTexture("credits"),
+                                          ResourceCache::GetTexture(TextureId::CREDITS),
                                           0.0, 0.0, 0.6,
                                           TextAnchor::CENTER, TextAnchor::CENTER));
 }
@@ -22,10 +22,7 @@ CreditsScreen::~CreditsScreen() {
 
 }
 
-void CreditsScreen::SwitchScreen(const map<string, string> &lastState) {
-  this->state.clear();
-  this->state["name"] = "menu-ongoing";
-
+void CreditsScreen::SwitchScreen(const Transition &from) {
   for (auto w : this->widgets)
     w->Reset();
 }
@@ -38,23 +35,22 @@ void CreditsScreen::HandleEvent(const SDL_Event &e) {
 void CreditsScreen::HandleWidgetEvent(int event_type, Widget *widget) {
   switch (event_type) {
   case BUTTON_CLICK:
-    PlaySound("button-click");
+    PlaySound(SoundId::CLICK);
 
     if (widget == this->widgets[0]) { // Main Menu
-      this->state["name"] = "credits-manu-selected";
+      this->Finish(TransitionType::BACK);
     }
 
     break;
 
   case BUTTON_MOUSE_ENTER:
-    PlaySound("mouse-over");
+    PlaySound(SoundId::HOVER);
     break;
   }
 }
 
 void CreditsScreen::Reset() {
-  this->state.clear();
-  this->state["name"] = "credits-ongoing";
+
 }
 
 void CreditsScreen::Save(ostream &s) const {
@@ -73,8 +69,7 @@ void CreditsScreen::Advance(float dt) {
 void CreditsScreen::Render(Renderer *renderer) {
   this->background.Draw();
 
-  for (auto w : this->widgets)
-    w->Render(renderer);
+  this->RenderWidgets(renderer);
 
   renderer->PresentScreen();
 }
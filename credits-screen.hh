@@ -13,7 +13,7 @@ public:
   CreditsScreen(SDL_Window *window);
   virtual ~CreditsScreen();
 
-  virtual void SwitchScreen(const map<string, string> &lastState);
+  virtual void SwitchScreen(const Transition &from);
   virtual void HandleEvent(const SDL_Event &e);
   virtual void HandleWidgetEvent(int event_type, Widget *widget);
 
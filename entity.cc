@@ -4,9 +4,50 @@
 
 #include <exception>
 #include <iostream>
+#include <map>
+#include <cmath>
 
 using namespace std;
 
+// Meshes are shared by all the entities of the same archetype, so that
+// they can be drawn together using instancing. They keep their
+// textures retained, so they are freed along with the game screen to
+// let the resource cache evict those textures.
+map<string, Mesh*> archetypeMeshes;
+
+const CircleStyle PlanetStyle = {
+  {0.52f, 0.49f, 0.52f, 1.0f}, // fill
+  {0.81f, 0.80f, 0.81f, 1.0f}, // edge
+  0.15f,                       // ring
+  0.0f,                        // glow
+  0.0f,                        // softness
+};
+
+const CircleStyle SunStyle = {
+  {1.0f, 0.84f, 0.0f, 1.0f},   // fill
+  {1.0f, 0.27f, 0.0f, 0.78f},  // edge
+  0.5f,                        // ring
+  0.35f,                       // glow
+  0.0f,                        // softness
+};
+
+Mesh *GetArchetypeMesh(const string &name, const GLfloat *vertexData, int n, GLuint texture) {
+  auto it = archetypeMeshes.find(name);
+  if (it != archetypeMeshes.end())
+    return it->second;
+
+  Mesh *mesh = new Mesh(vertexData, n, texture);
+  archetypeMeshes[name] = mesh;
+
+  return mesh;
+}
+
+void Entity::ReleaseArchetypeMeshes() {
+  for (auto &p : archetypeMeshes)
+    delete p.second;
+  archetypeMeshes.clear();
+}
+
 Entity::Entity() :
   hasPhysics(false),
   body(nullptr),
@@ -25,12 +66,14 @@ Entity::Entity() :
   spawnPlanet(false),
   isDrawable(false),
   mesh(nullptr),
+  circleStyle(nullptr),
+  circleRadius(0.0),
+  boundingRadius(0.0),
   planetWhooshChannel(-1)
 {
 }
 
 Entity::~Entity() {
-  delete this->mesh;
   if (this->planetWhooshChannel != -1) {
     Mix_HaltChannel(this->planetWhooshChannel);
 
@@ -213,24 +256,13 @@ Entity *Entity::CreatePlanet(b2World *world,
   e->isSun = false;
 
   e->isPlanet = true;
-  e->planetWhooshChannel = Mix_PlayChannel(-1, ResourceCache::GetSound("brown"), -1);
+  e->planetWhooshChannel = Mix_PlayChannel(-1, ResourceCache::GetSound(SoundId::BROWN), -1);
   Mix_Volume(e->planetWhooshChannel, 0);
 
-  // Create mesh.
-  GLfloat vertexData[] = {
-    // triangle 1
-    /* coord */ -radius, -radius, /* tex_coord */ 0.0f, 0.0f,
-    /* coord */ -radius,  radius, /* tex_coord */ 0.0f, 1.0f,
-    /* coord */  radius, -radius, /* tex_coord */ 1.0f, 0.0f,
-
-    // triangle 2
-    /* coord */ -radius,  radius, /* tex_coord */ 0.0f, 1.0f,
-    /* coord */  radius,  radius, /* tex_coord */ 1.0f, 1.0f,
-    /* coord */  radius, -radius, /* tex_coord */ 1.0f, 0.0f,
-  };
-
-  e->mesh = new Mesh(vertexData, 6, ResourceCache::GetTexture("planet"));
+  e->circleStyle = &PlanetStyle;
+  e->circleRadius = radius;
   e->isDrawable = true;
+  e->boundingRadius = radius;
 
   e->body->SetUserData(e);
 
@@ -267,21 +299,10 @@ Entity *Entity::CreateSun(b2World *world,
   e->isSun = true;
   e->isPlanet = false;
 
-  // Create mesh.
-  GLfloat vertexData[] = {
-    // triangle 1
-    /* coord */ -radius, -radius, /* tex_coord */ 0.0f, 0.0f,
-    /* coord */ -radius,  radius, /* tex_coord */ 0.0f, 1.0f,
-    /* coord */  radius, -radius, /* tex_coord */ 1.0f, 0.0f,
-
-    // triangle 2
-    /* coord */ -radius,  radius, /* tex_coord */ 0.0f, 1.0f,
-    /* coord */  radius,  radius, /* tex_coord */ 1.0f, 1.0f,
-    /* coord */  radius, -radius, /* tex_coord */ 1.0f, 0.0f,
-  };
-
-  e->mesh = new Mesh(vertexData, 6, ResourceCache::GetTexture("sun"));
+  e->circleStyle = &SunStyle;
+  e->circleRadius = radius;
   e->isDrawable = true;
+  e->boundingRadius = radius * (1.0 + SunStyle.glow);
 
   e->body->SetUserData(e);
 
@@ -305,35 +326,35 @@ Entity *Entity::CreateCollectible(b2World *world, b2Vec2 pos, CollectibleType ty
 
   e->isCollectible = true;
 
-  GLuint texture = 0;
+  TextureId texture;
   switch (type) {
   case CollectibleType::PLUS_SCORE:
     e->hasScore = true;
     e->score = 100;
-    texture = ResourceCache::GetTexture("plus-score");
+    texture = TextureId::PLUS_SCORE;
     break;
 
   case CollectibleType::MINUS_SCORE:
     e->hasScore = true;
     e->score = -100;
-    texture = ResourceCache::GetTexture("minus-score");
+    texture = TextureId::MINUS_SCORE;
     break;
 
   case CollectibleType::PLUS_TIME:
     e->hasTime = true;
     e->time = 10;
-    texture = ResourceCache::GetTexture("plus-time");
+    texture = TextureId::PLUS_TIME;
     break;
 
   case CollectibleType::MINUS_TIME:
     e->hasTime = true;
     e->time = -10;
-    texture = ResourceCache::GetTexture("minus-time");
+    texture = TextureId::MINUS_TIME;
     break;
 
   case CollectibleType::SPAWN_PLANET:
     e->spawnPlanet = true;
-    texture = ResourceCache::GetTexture("plus-planet");
+    texture = TextureId::PLUS_PLANET;
     break;
 
   default:
@@ -355,8 +376,10 @@ Entity *Entity::CreateCollectible(b2World *world, b2Vec2 pos, CollectibleType ty
     /* coord */  1.5f, -1.5f, /* tex_coord */ 1.0f, 0.0f,
   };
 
-  e->mesh = new Mesh(vertexData, 6, texture);
+  e->mesh = GetArchetypeMesh(string("collectible-") + GetResourceName(texture), vertexData, 6,
+                             ResourceCache::GetTexture(texture));
   e->isDrawable = true;
+  e->boundingRadius = 1.5 * sqrt(2.0);
 
   e->body->SetUserData(e);
 
@@ -412,8 +435,9 @@ Entity *Entity::CreateEnemyShip(b2World *world, b2Vec2 pos, b2Vec2 velocity, flo
     /* coord */ 1.8359375, -2.0, /* tex_coord */ 0.8755980861244019, 0.0,
   };
 
-  e->mesh = new Mesh(vertexData, 12, ResourceCache::GetTexture("enemy"));
+  e->mesh = GetArchetypeMesh("enemy", vertexData, 12, ResourceCache::GetTexture(TextureId::ENEMY));
   e->isDrawable = true;
+  e->boundingRadius = 2.75; // farthest vertex is about 2.74 from the origin
 
   e->body->SetUserData(e);
 
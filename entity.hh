@@ -2,6 +2,7 @@
 #define _GRAVITY_ENTITY_HH_
 
 #include "mesh.hh"
+#include "circle.hh"
 
 #include <Box2D/Box2D.h>
 
@@ -77,7 +78,16 @@ public:
   bool spawnPlanet;
 
   bool isDrawable;
-  Mesh *mesh;
+  Mesh *mesh; // shared by all entities of the same kind; not owned.
+
+  /// If not null, the entity is drawn as a procedural circle of
+  /// radius `circleRadius` with this style, instead of with a mesh.
+  const CircleStyle *circleStyle;
+  float32 circleRadius;
+
+  /// The radius of a circle around the body's position that contains
+  /// the whole mesh, at any angle. Used for view culling.
+  float32 boundingRadius;
 
   void Save(ostream &s) const;
   void Load(istream &s, b2World *world);
@@ -99,6 +109,10 @@ public:
                                  b2Vec2 pos,
                                  b2Vec2 velocity,
                                  float32 angle);
+
+  /// Frees the meshes shared by entities of the same kind. Only to be
+  /// called once no entities are left.
+  static void ReleaseArchetypeMeshes();
 };
 
 #endif /* _GRAVITY_ENTITY_HH_ */
@@ -0,0 +1,130 @@
+#include "font-atlas.hh"
+#include "gl-diagnostics.hh"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+// Width of the atlas texture; the height is whatever the glyphs need.
+const int ATLAS_WIDTH = 1024;
+
+// Empty space left around each glyph so that linear filtering never
+// picks up pixels of the neighbouring glyphs.
+const int GLYPH_PADDING = 1;
+
+FontAtlas::FontAtlas(TTF_Font *font, int pixelSize) :
+  pixelSize(pixelSize),
+  lineHeight(TTF_FontHeight(font))
+{
+  const int count = LAST_CHAR - FIRST_CHAR + 1;
+  SDL_Surface *surfaces[count];
+
+  // Render all glyphs first and pack them into shelves, so that the
+  // height of the texture is known before creating it.
+  int x = GLYPH_PADDING, y = GLYPH_PADDING, shelfHeight = 0;
+  int positions[count][2];
+  for (int i = 0; i < count; ++i) {
+    Uint16 c = FIRST_CHAR + i;
+
+    int minx, maxx, miny, maxy, advance;
+    if (TTF_GlyphMetrics(font, c, &minx, &maxx, &miny, &maxy, &advance) == -1)
+      advance = 0;
+
+    // Render the character as a one-character string rather than
+    // with TTF_RenderGlyph_Blended. That way the surface always spans
+    // the whole line height, with the glyph placed relative to the
+    // baseline and the pen position like in any other text.
+    const char str[] = {(char) c, '\0'};
+    surfaces[i] = TTF_RenderText_Blended(font, str, {255, 255, 255, 255});
+    if (surfaces[i] == nullptr) {
+      stringstream ss;
+      ss << "Unable to render glyph. SDL_ttf error: " << TTF_GetError();
+      throw runtime_error(ss.str());
+    }
+
+    int w = surfaces[i]->w, h = surfaces[i]->h;
+    if (x + w + GLYPH_PADDING > ATLAS_WIDTH) {
+      x = GLYPH_PADDING;
+      y += shelfHeight + GLYPH_PADDING;
+      shelfHeight = 0;
+    }
+
+    positions[i][0] = x;
+    positions[i][1] = y;
+    this->glyphs[i].width = w;
+    this->glyphs[i].height = h;
+    this->glyphs[i].advance = advance;
+
+    x += w + GLYPH_PADDING;
+    shelfHeight = max(shelfHeight, h);
+  }
+
+  int height = 1;
+  while (height < y + shelfHeight + GLYPH_PADDING)
+    height *= 2;
+
+  // Copy the coverage of each glyph into the single-channel image.
+  vector<Uint8> pixels(ATLAS_WIDTH * height, 0);
+  for (int i = 0; i < count; ++i) {
+    SDL_Surface *s = surfaces[i];
+    int gx = positions[i][0], gy = positions[i][1];
+
+    SDL_LockSurface(s);
+    for (int row = 0; row < s->h; ++row) {
+      const Uint8 *src = (const Uint8*) s->pixels + row * s->pitch;
+      for (int col = 0; col < s->w; ++col) {
+        Uint8 r, g, b, a;
+        SDL_GetRGBA(((const Uint32*) src)[col], s->format, &r, &g, &b, &a);
+        pixels[(gy + row) * ATLAS_WIDTH + gx + col] = a;
+      }
+    }
+    SDL_UnlockSurface(s);
+    SDL_FreeSurface(s);
+
+    GlyphInfo &glyph = this->glyphs[i];
+    glyph.s0 = (float) gx / ATLAS_WIDTH;
+    glyph.s1 = (float) (gx + glyph.width) / ATLAS_WIDTH;
+    glyph.t0 = (float) gy / height;
+    glyph.t1 = (float) (gy + glyph.height) / height;
+  }
+
+  glGenTextures(1, &this->texture);
+  glBindTexture(GL_TEXTURE_2D, this->texture);
+
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, ATLAS_WIDTH, height, 0, GL_RED, GL_UNSIGNED_BYTE, pixels.data());
+  this->byteSize = pixels.size();
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+  glBindTexture(GL_TEXTURE_2D, 0);
+  GL_CHECK("font-atlas");
+}
+
+FontAtlas::~FontAtlas() {
+  glDeleteTextures(1, &this->texture);
+}
+
+float FontAtlas::GetLineHeight(float heightPixels) const {
+  return this->lineHeight * heightPixels / this->pixelSize;
+}
+
+const GlyphInfo &FontAtlas::GetGlyph(char c) const {
+  if (c < FIRST_CHAR || c > LAST_CHAR)
+    c = '?';
+
+  return this->glyphs[c - FIRST_CHAR];
+}
+
+float FontAtlas::GetTextWidth(const string &text, float heightPixels) const {
+  int advance = 0;
+  for (auto c : text)
+    advance += this->GetGlyph(c).advance;
+
+  return advance * heightPixels / this->pixelSize;
+}
@@ -0,0 +1,64 @@
+#ifndef _GRAVITY_FONT_ATLAS_HH_
+#define _GRAVITY_FONT_ATLAS_HH_
+
+#include "gl-loader.hh"
+
+#include <SDL2/SDL_ttf.h>
+
+#include <string>
+
+using namespace std;
+
+struct GlyphInfo {
+  // Texture coordinates in the atlas; t0 is the top row.
+  float s0;
+  float t0;
+  float s1;
+  float t1;
+
+  // Size of the glyph cell and the horizontal advance, in pixels at
+  // the atlas size.
+  int width;
+  int height;
+  int advance;
+};
+
+/// The printable ASCII characters of a font rendered once into a
+/// single-channel texture. Text of any size close to the size of the
+/// atlas is drawn as one quad per character from it.
+class FontAtlas {
+public:
+  static const char FIRST_CHAR = ' ';
+  static const char LAST_CHAR = '~';
+
+protected:
+  GLuint texture;
+  size_t byteSize;
+  int pixelSize;
+  int lineHeight;
+  GlyphInfo glyphs[LAST_CHAR - FIRST_CHAR + 1];
+
+public:
+  FontAtlas(TTF_Font *font, int pixelSize);
+  ~FontAtlas();
+
+  GLuint GetTexture() const { return this->texture; }
+
+  /// The memory taken by the texture.
+  size_t GetByteSize() const { return this->byteSize; }
+
+  /// The pixel height the glyphs were rendered at.
+  int GetPixelSize() const { return this->pixelSize; }
+
+  /// The height of a line of text drawn with the given pixel size.
+  float GetLineHeight(float heightPixels) const;
+
+  /// Returns the glyph for `c`, or the one for '?' if the character is
+  /// not in the atlas.
+  const GlyphInfo &GetGlyph(char c) const;
+
+  /// The width in pixels of `text` drawn with the given pixel size.
+  float GetTextWidth(const string &text, float heightPixels) const;
+};
+
+#endif /* _GRAVITY_FONT_ATLAS_HH_ */
@@ -0,0 +1,93 @@
+#include "frame-pacer.hh"
+
+#include <cstdlib>
+#include <iostream>
+
+using namespace std;
+
+// SDL_Delay may oversleep by a millisecond or two depending on the OS
+// scheduler, so the last stretch before a deadline is spent spinning.
+const float SPIN_SECONDS = 0.002;
+
+FramePacer::FramePacer(int frameRate) :
+  frequency(SDL_GetPerformanceFrequency()),
+  refreshTicks(0),
+  swapInterval(0)
+{
+  this->spinTicks = SPIN_SECONDS * this->frequency;
+  this->SetFrameRate(frameRate);
+  this->Reset();
+}
+
+void FramePacer::SetFrameRate(int frameRate) {
+  this->frameTicks = frameRate > 0 ? this->frequency / frameRate : 0;
+}
+
+int FramePacer::SetSwapInterval(int interval) {
+  if (SDL_GL_SetSwapInterval(interval) == -1) {
+    if (interval == -1) {
+      cout << "Adaptive vsync not supported; using vsync." << endl;
+      return this->SetSwapInterval(1);
+    }
+
+    cout << "Could not set swap interval: " << SDL_GetError() << endl;
+  }
+
+  this->swapInterval = SDL_GL_GetSwapInterval();
+
+  // With vsync, a frame takes at least this long to be presented.
+  this->refreshTicks = 0;
+  SDL_DisplayMode mode;
+  SDL_Window *window = SDL_GL_GetCurrentWindow();
+  if (this->swapInterval != 0 && window &&
+      SDL_GetWindowDisplayMode(window, &mode) == 0 && mode.refresh_rate > 0)
+    this->refreshTicks = this->frequency * abs(this->swapInterval) / mode.refresh_rate;
+
+  return this->swapInterval;
+}
+
+float FramePacer::Wait() {
+  Uint64 now = SDL_GetPerformanceCounter();
+
+  // When vsync alone keeps the frame rate at or below the target, the
+  // buffer swap has already waited for the display. Waiting again
+  // would only risk missing the next refresh. A frame that came back
+  // well within a refresh was not presented though, so then the pacer
+  // waits out the refresh period itself.
+  Uint64 frameTicks = this->frameTicks;
+  if (this->refreshTicks > 0 && frameTicks <= this->refreshTicks) {
+    frameTicks = this->refreshTicks;
+    if (now - this->lastFrame >= this->refreshTicks / 2)
+      this->deadline = now;
+  }
+
+  if (frameTicks > 0) {
+    if (now < this->deadline) {
+      // Sleep for most of the remaining time, then spin until the
+      // deadline.
+      Uint64 remaining = this->deadline - now;
+      if (remaining > this->spinTicks)
+        SDL_Delay((remaining - this->spinTicks) * 1000 / this->frequency);
+
+      while ((now = SDL_GetPerformanceCounter()) < this->deadline)
+        ;
+    }
+
+    // Keep to the original schedule so that small delays do not add
+    // up, unless we have fallen more than a whole frame behind (which
+    // is always the case when vsync is slower than the target rate).
+    this->deadline += frameTicks;
+    if (this->deadline < now)
+      this->deadline = now + frameTicks;
+  }
+
+  float elapsed = (float) (now - this->lastFrame) / this->frequency;
+  this->lastFrame = now;
+
+  return elapsed;
+}
+
+void FramePacer::Reset() {
+  this->lastFrame = SDL_GetPerformanceCounter();
+  this->deadline = this->lastFrame;
+}
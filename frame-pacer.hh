@@ -0,0 +1,45 @@
+#ifndef _GRAVITY_FRAME_PACER_HH_
+#define _GRAVITY_FRAME_PACER_HH_
+
+#include <SDL2/SDL.h>
+
+/// Keeps the main loop at a steady frame rate, timed with the
+/// high-resolution performance counter.
+///
+/// With vsync on, swapping buffers already blocks until the display is
+/// ready, so the pacer only ever waits when the target frame rate is
+/// below the display rate, or when no frame was presented at all.
+class FramePacer {
+protected:
+  Uint64 frequency;
+  Uint64 frameTicks;
+  Uint64 spinTicks;
+  Uint64 deadline;
+  Uint64 lastFrame;
+  Uint64 refreshTicks;
+  int swapInterval;
+
+public:
+  /// A frame rate of zero means no limit.
+  FramePacer(int frameRate);
+
+  void SetFrameRate(int frameRate);
+
+  /// Sets the swap interval of the current OpenGL context: 0 for no
+  /// vsync, 1 for vsync, -1 for adaptive vsync, which does not wait
+  /// for the display when a frame is late. Falls back to plain vsync if
+  /// adaptive vsync is not supported. Returns the interval in effect.
+  int SetSwapInterval(int interval);
+
+  int GetSwapInterval() const { return this->swapInterval; }
+
+  /// Waits until the next frame is due. Returns the time in seconds
+  /// since the previous call.
+  float Wait();
+
+  /// Starts timing over, e.g. after the loop has been blocked waiting
+  /// for events, so that the time spent waiting is not counted.
+  void Reset();
+};
+
+#endif /* _GRAVITY_FRAME_PACER_HH_ */
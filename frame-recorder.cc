@@ -0,0 +1,207 @@
+#include "frame-recorder.hh"
+#include "platform.hh"
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+// Frames read back at the same time. Three cover the GPU running a
+// couple of frames behind.
+const int READBACK_SLOTS = 3;
+
+// Frames waiting for the writer thread. Beyond this, frames are
+// dropped instead of letting memory use grow.
+const size_t MAX_QUEUED_FRAMES = 8;
+
+FrameRecorder::FrameRecorder(const string &target, int frameRate) :
+  target(target),
+  isPipe(!target.empty() && target[0] == '|'),
+  frameRate(frameRate),
+  width(0),
+  height(0),
+  readback(READBACK_SLOTS),
+  capturedFrames(0),
+  droppedFrames(0),
+  stopping(false),
+  writtenFrames(0),
+  writeFailed(false)
+{
+  if (this->isPipe) {
+    this->format = Format::Y4M;
+    this->output = OpenOutputPipe(target.substr(1));
+  }
+  else {
+    size_t n = target.size();
+    if (n >= 4 && target.compare(n - 4, 4, ".y4m") == 0)
+      this->format = Format::Y4M;
+    else
+      this->format = Format::RAW;
+    this->output = fopen(target.data(), "wb");
+  }
+
+  if (this->output == nullptr) {
+    stringstream ss;
+    ss << "Could not open " << target << " for recording.";
+    throw runtime_error(ss.str());
+  }
+
+  this->worker = thread(&FrameRecorder::Run, this);
+}
+
+FrameRecorder::~FrameRecorder() {
+  this->Collect(true);
+
+  {
+    lock_guard<mutex> lock(this->queueMutex);
+    this->stopping = true;
+  }
+  this->queueCondition.notify_one();
+  this->worker.join();
+
+  if (this->isPipe)
+    CloseOutputPipe(this->output);
+  else
+    fclose(this->output);
+
+  cout << "Recorded " << this->writtenFrames << " frames to " << this->target
+       << " (" << this->droppedFrames << " dropped)." << endl;
+}
+
+void FrameRecorder::Capture(int width, int height) {
+  // YUV 4:2:0 has one chroma sample per 2x2 block, so leave out the
+  // last row or column if there is an odd one.
+  if (this->format == Format::Y4M) {
+    width &= ~1;
+    height &= ~1;
+  }
+
+  if (this->width == 0) {
+    this->width = width;
+    this->height = height;
+  }
+
+  this->Collect(false);
+
+  this->capturedFrames++;
+  if (width != this->width || height != this->height || this->writeFailed ||
+      !this->readback.Start(width, height))
+    this->droppedFrames++;
+}
+
+void FrameRecorder::Collect(bool wait) {
+  PixelImage image;
+  while (this->readback.Finish(image, wait))
+    this->Queue(image);
+}
+
+void FrameRecorder::Queue(PixelImage &image) {
+  {
+    lock_guard<mutex> lock(this->queueMutex);
+    if (this->queue.size() < MAX_QUEUED_FRAMES) {
+      this->queue.push_back(move(image));
+      image = PixelImage();
+    }
+    else {
+      this->droppedFrames++;
+      return;
+    }
+  }
+  this->queueCondition.notify_one();
+}
+
+void FrameRecorder::Run() {
+  bool headerWritten = false;
+
+  for (;;) {
+    unique_lock<mutex> lock(this->queueMutex);
+    this->queueCondition.wait(lock, [this] { return this->stopping || !this->queue.empty(); });
+
+    if (this->queue.empty())
+      return;
+
+    PixelImage image = move(this->queue.front());
+    this->queue.pop_front();
+    lock.unlock();
+
+    if (this->writeFailed)
+      continue;
+
+    if (!headerWritten) {
+      headerWritten = true;
+      if (!this->WriteHeader())
+        this->writeFailed = true;
+    }
+
+    if (!this->writeFailed && !this->WriteFrame(image))
+      this->writeFailed = true;
+
+    if (this->writeFailed)
+      cout << "Could not write to " << this->target << "; recording stopped." << endl;
+    else
+      this->writtenFrames++;
+  }
+}
+
+bool FrameRecorder::WriteHeader() {
+  if (this->format != Format::Y4M)
+    return true;
+
+  // C420jpeg: full-range BT.601, chroma sited between the luma samples,
+  // which is what averaging each 2x2 block gives.
+  return fprintf(this->output, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n",
+                 this->width, this->height, this->frameRate) > 0;
+}
+
+bool FrameRecorder::WriteFrame(const PixelImage &image) {
+  int w = image.width, h = image.height;
+  size_t rowSize = w * 4;
+
+  // Rows are read back bottom first; streams have them top first.
+  if (this->format == Format::RAW) {
+    for (int y = h - 1; y >= 0; --y)
+      if (fwrite(image.pixels.data() + y * rowSize, 1, rowSize, this->output) != rowSize)
+        return false;
+    return true;
+  }
+
+  this->frameBuffer.resize(w * h * 3 / 2);
+  uint8_t *yPlane = this->frameBuffer.data();
+  uint8_t *uPlane = yPlane + w * h;
+  uint8_t *vPlane = uPlane + (w / 2) * (h / 2);
+
+  for (int y = 0; y < h; y += 2) {
+    const uint8_t *row0 = image.pixels.data() + (h - 1 - y) * rowSize;
+    const uint8_t *row1 = row0 - rowSize;
+    uint8_t *y0 = yPlane + y * w;
+    uint8_t *y1 = y0 + w;
+
+    for (int x = 0; x < w; x += 2) {
+      const uint8_t *p[4] = {row0 + x * 4, row0 + x * 4 + 4, row1 + x * 4, row1 + x * 4 + 4};
+
+      int r = 0, g = 0, b = 0;
+      for (int i = 0; i < 4; ++i) {
+        r += p[i][0];
+        g += p[i][1];
+        b += p[i][2];
+      }
+
+      // Fixed point BT.601 with 8 fractional bits; the chroma offsets
+      // keep everything positive before shifting.
+      y0[x] = (77 * p[0][0] + 150 * p[0][1] + 29 * p[0][2] + 128) >> 8;
+      y0[x + 1] = (77 * p[1][0] + 150 * p[1][1] + 29 * p[1][2] + 128) >> 8;
+      y1[x] = (77 * p[2][0] + 150 * p[2][1] + 29 * p[2][2] + 128) >> 8;
+      y1[x + 1] = (77 * p[3][0] + 150 * p[3][1] + 29 * p[3][2] + 128) >> 8;
+
+      r = (r + 2) / 4;
+      g = (g + 2) / 4;
+      b = (b + 2) / 4;
+      int i = (y / 2) * (w / 2) + x / 2;
+      uPlane[i] = min((-43 * r - 85 * g + 128 * b + 32896) >> 8, 255);
+      vPlane[i] = min((128 * r - 107 * g - 21 * b + 32896) >> 8, 255);
+    }
+  }
+
+  return fputs("FRAME\n", this->output) >= 0 &&
+    fwrite(this->frameBuffer.data(), 1, this->frameBuffer.size(), this->output) == this->frameBuffer.size();
+}
@@ -0,0 +1,83 @@
+#ifndef _GRAVITY_FRAME_RECORDER_HH_
+#define _GRAVITY_FRAME_RECORDER_HH_
+
+#include "pixel-readback.hh"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+using namespace std;
+
+/// Records every frame presented into a video stream. Frames are read
+/// back through a ring of pixel buffer objects and handed to a writer
+/// thread, which converts and writes them. When either the GPU or the
+/// writer cannot keep up, frames are dropped, and counted, rather than
+/// holding up the game.
+///
+/// The target is a file name, or a command to pipe the stream into
+/// when it starts with '|'. Files ending in ".y4m" and pipes get a
+/// YUV4MPEG2 stream (4:2:0, which most encoders accept as is); anything
+/// else gets raw RGBA frames, top row first.
+class FrameRecorder {
+public:
+  enum class Format {
+    RAW,
+    Y4M
+  };
+
+protected:
+  string target;
+  Format format;
+  FILE *output;
+  bool isPipe;
+  int frameRate;
+
+  // The size of the first frame. Frames of any other size, e.g. after
+  // the window was resized, are dropped.
+  int width;
+  int height;
+
+  PixelReadback readback;
+  int capturedFrames;
+  int droppedFrames;
+
+  deque<PixelImage> queue;
+  bool stopping;
+  mutex queueMutex;
+  condition_variable queueCondition;
+  thread worker;
+  atomic<int> writtenFrames;
+  atomic<bool> writeFailed;
+
+  // Used by the writer thread only.
+  vector<uint8_t> frameBuffer;
+
+  void Collect(bool wait);
+  void Queue(PixelImage &image);
+  void Run();
+  bool WriteHeader();
+  bool WriteFrame(const PixelImage &image);
+
+public:
+  /// Opens the target for writing; throws a runtime_error if it cannot
+  /// be opened. Needs an OpenGL context.
+  FrameRecorder(const string &target, int frameRate);
+
+  /// Writes out the frames still in flight and closes the target.
+  ~FrameRecorder();
+
+  /// Reads back the bottom-left width x height pixels of the current
+  /// read framebuffer. Meant to be called once per frame, right before
+  /// presenting it.
+  void Capture(int width, int height);
+
+  int GetCapturedFrames() const { return this->capturedFrames; }
+  int GetDroppedFrames() const { return this->droppedFrames; }
+};
+
+#endif /* _GRAVITY_FRAME_RECORDER_HH_ */
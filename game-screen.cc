@@ -7,6 +7,7 @@
 #include <sstream>
 #include <iomanip>
 #include <functional>
+#include <cmath>
 
 #define M_PI 3.14159265358979323846
 
@@ -58,7 +59,7 @@ void ContactListener::BeginContact(b2Contact *contact) {
 }
 
 void ContactListener::EnemySunContact(Entity *enemy, Entity *sun) {
-  PlaySound("enemy-collision");
+  PlaySound(SoundId::ENEMY_COLLISION);
 
   this->screen->SetTimeRemaining(this->screen->timeRemaining - 10);
   if (this->screen->timeRemaining < 0)
@@ -68,7 +69,7 @@ void ContactListener::EnemySunContact(Entity *enemy, Entity *sun) {
 }
 
 void ContactListener::EnemyPlanetContact(Entity *enemy, Entity *sun) {
-  PlaySound("enemy-collision");
+  PlaySound(SoundId::ENEMY_COLLISION);
 
   this->screen->SetTimeRemaining(this->screen->timeRemaining - 10);
   if (this->screen->timeRemaining < 0)
@@ -78,7 +79,7 @@ void ContactListener::EnemyPlanetContact(Entity *enemy, Entity *sun) {
 }
 
 void ContactListener::PlanetSunContact(Entity *planet, Entity *sun) {
-  PlaySound("planet-sun-collision");
+  PlaySound(SoundId::PLANET_SUN_COLLISION);
 
   if (!this->inContact)
     this->screen->SetTimeRemaining(this->screen->timeRemaining - 10);
@@ -89,7 +90,7 @@ void ContactListener::PlanetSunContact(Entity *planet, Entity *sun) {
 }
 
 void ContactListener::CollectibleSunContact(Entity *collectible, Entity *sun) {
-  PlaySound("sun-powerup");
+  PlaySound(SoundId::SUN_POWERUP);
 
   if (collectible->hasScore)
     this->screen->SetScore(this->screen->score + collectible->score);
@@ -104,7 +105,7 @@ void ContactListener::CollectibleSunContact(Entity *collectible, Entity *sun) {
 }
 
 void ContactListener::CollectiblePlanetContact(Entity *collectible, Entity *planet) {
-  PlaySound("planet-powerup");
+  PlaySound(SoundId::PLANET_POWERUP);
 
   if (collectible->hasScore)
     this->screen->SetScore(this->screen->score + 10 * collectible->score);
@@ -138,6 +139,24 @@ bool ContactFilter::ShouldCollide(b2Fixture *fixtureA, b2Fixture *fixtureB) {
   return true;
 }
 
+// Trail points are drawn as soft red dots. Their radius is this
+// multiplied by the ratio of the trail point size and the radius of
+// the planet leaving the trail.
+const float32 TrailPointSize = 2.0;
+
+const CircleStyle TrailPointStyle = {
+  {1.0f, 0.12f, 0.09f, 0.7f}, // fill
+  {1.0f, 0.12f, 0.09f, 0.7f}, // edge
+  0.0f,                       // ring
+  0.0f,                       // glow
+  0.3f,                       // softness
+};
+
+bool RectsOverlap(const b2Vec2 &min1, const b2Vec2 &max1, const b2Vec2 &min2, const b2Vec2 &max2) {
+  return min1.x <= max2.x && max1.x >= min2.x &&
+         min1.y <= max2.y && max1.y >= min2.y;
+}
+
 b2Body *GetBodyFromPoint(b2Vec2 p, b2World *world) {
   for (b2Body *b = world->GetBodyList(); b; b = b->GetNext()) {
     for (b2Fixture *f = b->GetFixtureList(); f; f = f->GetNext()) {
@@ -151,17 +170,20 @@ b2Body *GetBodyFromPoint(b2Vec2 p, b2World *world) {
 
 GameScreen::GameScreen(SDL_Window *window) :
   Screen(window),
+  spawnPlanet(false),
   world(b2Vec2(0.0, 0.0)),
   timer(bind(&GameScreen::TimerCallback, this, _1)),
   contactListener(this),
   frameCount(0),
+  fpsStart(SDL_GetPerformanceCounter()),
   fps(0),
-  spawnPlanet(false),
-  background(window, ResourceCache::GetTexture("background")),
+  cullingStats({0, 0}),
+  physicsStats({0, 0, 0.0}),
+  timeScale(1.0),
+  renderScale(1.0),
+  background(window, ResourceCache::GetTexture(TextureId::BACKGROUND_DARK)),
   discardLeftButtonUp(false)
 {
-  this->timer.Set(1.0, true);
-
   this->world.SetContactListener(&this->contactListener);
   this->world.SetContactFilter(&this->contactFilter);
 
@@ -185,34 +207,34 @@ GameScreen::GameScreen(SDL_Window *window) :
                                    {255, 255, 255, 128});
 #endif
   this->continueLabel = new ImageWidget(this,
-                                        ResourceCache::GetTexture("continue"),
+                                        ResourceCache::GetTexture(TextureId::CONTINUE),
                                         0.0, -0.15, 0.05,
                                         TextAnchor::CENTER, TextAnchor::CENTER,
                                         {255, 255, 255, 128});
   this->pauseSign = new ImageWidget(this,
-                                    ResourceCache::GetTexture("pause"),
+                                    ResourceCache::GetTexture(TextureId::PAUSE),
                                     0.0, 0.0, 0.2,
                                     TextAnchor::CENTER, TextAnchor::CENTER,
                                     {255, 255, 255, 128});
   this->endGameButton = new ImageButtonWidget(this,
-                                              ResourceCache::GetTexture("end-game"),
+                                              ResourceCache::GetTexture(TextureId::END_GAME),
                                               0.02, 0.02, 0.05,
                                               TextAnchor::RIGHT, TextAnchor::BOTTOM,
                                               {255, 0, 0, 128},
                                               {255, 255, 255, 128});
   this->muteButton = new ImageButtonWidget(this,
-                                           ResourceCache::GetTexture("mute"),
+                                           ResourceCache::GetTexture(TextureId::MUTE),
                                            0.05, 0.05, 0.08,
                                            TextAnchor::LEFT, TextAnchor::BOTTOM,
                                            {255, 128, 128, 255},
                                            {255, 255, 255, 128});
   this->gameOverLabel = new ImageWidget(this,
-                                        ResourceCache::GetTexture("game-over"),
+                                        ResourceCache::GetTexture(TextureId::GAME_OVER),
                                         0.0, 0.0, 0.1,
                                         TextAnchor::CENTER, TextAnchor::CENTER);
 
   this->livesLabel = new ImageWidget(this,
-                                     ResourceCache::GetTexture("lives3"),
+                                     ResourceCache::GetTexture(TextureId::LIVES3),
                                      0.0, 0.0, 0.04,
                                      TextAnchor::CENTER, TextAnchor::TOP,
                                      {255, 255, 255, 255});
@@ -229,21 +251,6 @@ GameScreen::GameScreen(SDL_Window *window) :
   this->widgets.push_back(this->gameOverLabel);
   this->widgets.push_back(this->livesLabel);
 
-  // Create the "trail point" mesh.
-  GLfloat trailPointVertexData[] = {
-    // triangle 1
-    /* coord */ -2.0f, -2.0f, /* tex_coord */ 0.0f, 0.0f,
-    /* coord */ -2.0f,  2.0f, /* tex_coord */ 0.0f, 1.0f,
-    /* coord */  2.0f, -2.0f, /* tex_coord */ 1.0f, 0.0f,
-
-    // triangle 2
-    /* coord */ -2.0f,  2.0f, /* tex_coord */ 0.0f, 1.0f,
-    /* coord */  2.0f,  2.0f, /* tex_coord */ 1.0f, 1.0f,
-    /* coord */  2.0f, -2.0f, /* tex_coord */ 1.0f, 0.0f,
-  };
-
-  this->trailPointMesh = new Mesh(trailPointVertexData, 6, ResourceCache::GetTexture("trail-point"));
-
   // Reset all state data.
   this->Reset();
 }
@@ -257,7 +264,7 @@ GameScreen::~GameScreen() {
   }
   this->entities.clear();
 
-  delete this->trailPointMesh;
+  Entity::ReleaseArchetypeMeshes();
 }
 
 void GameScreen::DiscardPlanet(Entity *planet) {
@@ -290,16 +297,16 @@ void GameScreen::DecreaseLives() {
   this->lives--;
   switch (this->lives) {
   case 0:
-    this->livesLabel->SetTexture(ResourceCache::GetTexture("lives0"));
+    this->livesLabel->SetTexture(ResourceCache::GetTexture(TextureId::LIVES0));
     break;
   case 1:
-    this->livesLabel->SetTexture(ResourceCache::GetTexture("lives1"));
+    this->livesLabel->SetTexture(ResourceCache::GetTexture(TextureId::LIVES1));
     break;
   case 2:
-    this->livesLabel->SetTexture(ResourceCache::GetTexture("lives2"));
+    this->livesLabel->SetTexture(ResourceCache::GetTexture(TextureId::LIVES2));
     break;
   case 3:
-    this->livesLabel->SetTexture(ResourceCache::GetTexture("lives3"));
+    this->livesLabel->SetTexture(ResourceCache::GetTexture(TextureId::LIVES3));
     break;
   }
 }
@@ -324,6 +331,12 @@ void GameScreen::TogglePause() {
   if (this->paused) {
     this->draggingBody = nullptr;
   }
+  else {
+    // Start counting frames over, so the time spent paused does not
+    // count.
+    this->frameCount = 0;
+    this->fpsStart = SDL_GetPerformanceCounter();
+  }
 
   Timer::TogglePauseAll();
 }
@@ -422,11 +435,11 @@ void GameScreen::SpawnPlanet() {
   this->entities.push_back(planet);
 }
 
-void GameScreen::SwitchScreen(const map<string, string> &lastState) {
+void GameScreen::SwitchScreen(const Transition &from) {
   if (mute)
-    this->muteButton->SetTexture(ResourceCache::GetTexture("unmute"));
+    this->muteButton->SetTexture(ResourceCache::GetTexture(TextureId::UNMUTE));
   else
-    this->muteButton->SetTexture(ResourceCache::GetTexture("mute"));
+    this->muteButton->SetTexture(ResourceCache::GetTexture(TextureId::MUTE));
 }
 
 void GameScreen::HandleEvent(const SDL_Event &e) {
@@ -489,6 +502,15 @@ void GameScreen::HandleEvent(const SDL_Event &e) {
     case SDLK_n:
       this->stepOnce = true;
       break;
+#ifndef RELEASE_BUILD
+    case SDLK_PLUS:
+    case SDLK_EQUALS:
+      this->SetTimeScale(this->timeScale * 2.0);
+      break;
+    case SDLK_MINUS:
+      this->SetTimeScale(this->timeScale / 2.0);
+      break;
+#endif
     }
     break;
 
@@ -503,32 +525,31 @@ void GameScreen::HandleEvent(const SDL_Event &e) {
 void GameScreen::HandleWidgetEvent(int event_type, Widget *widget) {
   switch (event_type) {
   case BUTTON_CLICK:
-    PlaySound("button-click");
+    PlaySound(SoundId::CLICK);
 
     if (widget == this->endGameButton) { // End Game
-      this->state["name"] = "game-over";
-      this->state["score"] = to_string(this->score);
+      this->over = true;
+      this->Finish(TransitionType::GAME_OVER, {this->score});
     }
     else if (widget == this->muteButton) { // Toggle Mute
       mute = !mute;
       if (mute)
-        this->muteButton->SetTexture(ResourceCache::GetTexture("unmute"));
+        this->muteButton->SetTexture(ResourceCache::GetTexture(TextureId::UNMUTE));
       else
-        this->muteButton->SetTexture(ResourceCache::GetTexture("mute"));
+        this->muteButton->SetTexture(ResourceCache::GetTexture(TextureId::MUTE));
     }
     this->discardLeftButtonUp = true;
 
     break;
 
   case BUTTON_MOUSE_ENTER:
-    PlaySound("mouse-over");
+    PlaySound(SoundId::HOVER);
     break;
   } // switch (event_type)
 }
 
 void GameScreen::Reset() {
-  this->state.clear();
-  this->state["name"] = "playing";
+  this->over = false;
 
   this->SetScore(0);
   this->SetTimeRemaining(Config::GameTime);
@@ -543,7 +564,7 @@ void GameScreen::Reset() {
   this->physicsTimeAccumulator = 0.0;
   this->scoreAccumulator = 0;
   this->lives = 3;
-  this->livesLabel->SetTexture(ResourceCache::GetTexture("lives3"));
+  this->livesLabel->SetTexture(ResourceCache::GetTexture(TextureId::LIVES3));
   this->spawnPlanet = false;
 
   // Remove existing entities.
@@ -567,22 +588,10 @@ void GameScreen::Reset() {
                                                 2.0,
                                                 1.0));
 
+  this->timer.Set(1.0, true);
   Timer::PauseAll();
   this->FixCamera();
 
-  int winw, winh;
-  SDL_GetWindowSize(window, &winw, &winh);
-
-  // Update OpenGL viewport.
-  glViewport(0, 0, winw, winh);
-
-  // Update window size in shader.
-  auto program = ResourceCache::texturedPolygonProgram;
-  glUseProgram(program);
-  GLuint resolutionUniform = glGetUniformLocation(program, "resolution");
-  glUniform2f(resolutionUniform, winw, winh);
-  glUseProgram(0);
-
   for (auto w : this->widgets)
     w->Reset();
 
@@ -597,7 +606,7 @@ void GameScreen::Reset() {
 }
 
 void GameScreen::Save(ostream &s) const {
-  SaveMap(this->state, s);
+  WRITE(this->over, s);
 
   WRITE(this->time, s);
   WRITE(this->score, s);
@@ -618,7 +627,7 @@ void GameScreen::Save(ostream &s) const {
 }
 
 void GameScreen::Load(istream &s) {
-  LoadMap(this->state, s);
+  READ(this->over, s);
 
   READ(this->time, s);
   READ(this->score, s);
@@ -663,7 +672,7 @@ void GameScreen::Advance(float dt) {
   for (auto w : this->widgets)
     w->Advance(dt);
 
-  if (this->state["name"] == "game-over")
+  if (this->over)
     return;
 
   if (this->paused && !this->stepOnce)
@@ -703,9 +712,28 @@ void GameScreen::Advance(float dt) {
     this->spawnPlanet = false;
   }
 
-  // Advance physics.
-  this->physicsTimeAccumulator += dt;
+  // The window size cannot change while stepping, so query it once
+  // rather than on every step.
+  int winw, winh;
+  SDL_GetWindowSize(this->window, &winw, &winh);
+
+  // Advance physics. After a stall, catching up on all of the lost
+  // time at once would only cause another stall, so the number of
+  // steps per frame is capped and the rest of the time is dropped. At
+  // higher time scales the cap grows accordingly.
+  int maxSteps = ceil(Config::MaxPhysicsStepsPerFrame * this->timeScale);
+  int steps = 0;
+  this->physicsTimeAccumulator += dt * this->timeScale;
   while (this->physicsTimeAccumulator >= Config::PhysicsTimeStep) {
+    if (steps == maxSteps) {
+      float32 dropped = this->physicsTimeAccumulator - fmod(this->physicsTimeAccumulator, Config::PhysicsTimeStep);
+      this->physicsStats.droppedTime += dropped;
+      this->physicsStats.droppedFrames++;
+      this->physicsTimeAccumulator -= dropped;
+      break;
+    }
+    steps++;
+
     // Update score.
     for (auto e : this->entities)
       if (e->isPlanet) {
@@ -717,7 +745,7 @@ void GameScreen::Advance(float dt) {
         if (this->scoreAccumulator >= 100) {
           this->SetScore(this->score + 100);
           this->scoreAccumulator -= 100;
-          PlaySound("score-tik");
+          PlaySound(SoundId::SCORE_TIK);
         }
       }
 
@@ -742,11 +770,9 @@ void GameScreen::Advance(float dt) {
     this->world.Step(Config::PhysicsTimeStep, 10, 10);
     this->time += Config::PhysicsTimeStep;
 
-    this->FixCamera();
+    this->FixCamera(winw, winh);
 
     // Remove out of bounds planets
-    int winw, winh;
-    SDL_GetWindowSize(this->window, &winw, &winh);
     float width = winw / this->camera.ppm;
     float height = winh / this->camera.ppm;
     float minx = this->camera.pos.x;
@@ -800,42 +826,140 @@ void GameScreen::Advance(float dt) {
     this->physicsTimeAccumulator -= Config::PhysicsTimeStep;
   }
 
+  this->physicsStats.steps = steps;
+
   this->stepOnce = false;
 }
 
 void GameScreen::Render(Renderer *renderer) {
   renderer->SetCamera(this->camera);
 
+  // The world may be drawn at a lower resolution and upscaled when the
+  // GPU cannot keep up; the HUD is always drawn at full resolution.
+  renderer->BeginWorldPass();
+
   this->background.Draw();
   //this->DrawGrid(renderer);
 
+  // Collect all trail points and entities into the batches, which
+  // then draw all circles, and each kind of mesh, with a single
+  // instanced call. Trails are added first so they are drawn below the
+  // planets.
+  this->circleBatch.Clear();
+  this->worldBatch.Clear();
+
+  // Only submit what overlaps the visible part of the world. Enemy
+  // ships, for example, spend quite some time off-screen.
+  int winw, winh;
+  SDL_GetWindowSize(this->window, &winw, &winh);
+  b2Vec2 viewMin = this->camera.pos;
+  b2Vec2 viewMax = this->camera.pos + b2Vec2(winw / this->camera.ppm, winh / this->camera.ppm);
+
+  this->cullingStats = {0, 0};
+
   for (auto e : this->entities)
-    if (e->hasTrail)
-      this->DrawTrail(renderer, e);
+    if (e->hasTrail && !e->trail.points.empty()) {
+      // Trail points are drawn as circles no larger than this.
+      const float32 pointRadius = 2.0;
+
+      b2Vec2 trailMin(FLT_MAX, FLT_MAX);
+      b2Vec2 trailMax(-FLT_MAX, -FLT_MAX);
+      for (auto &p : e->trail.points) {
+        trailMin.Set(min(trailMin.x, p.pos.x), min(trailMin.y, p.pos.y));
+        trailMax.Set(max(trailMax.x, p.pos.x), max(trailMax.y, p.pos.y));
+      }
+      trailMin -= b2Vec2(pointRadius, pointRadius);
+      trailMax += b2Vec2(pointRadius, pointRadius);
+
+      if (RectsOverlap(trailMin, trailMax, viewMin, viewMax)) {
+        this->DrawTrail(e);
+        this->cullingStats.drawn++;
+      }
+      else
+        this->cullingStats.culled++;
+    }
 
   for (auto e : this->entities)
-    if (e->isDrawable)
-      e->mesh->Draw(e->body->GetPosition(), e->body->GetAngle());
+    if (e->isDrawable) {
+      b2Vec2 pos = e->body->GetPosition();
+      b2Vec2 extent(e->boundingRadius, e->boundingRadius);
+
+      if (RectsOverlap(pos - extent, pos + extent, viewMin, viewMax)) {
+        if (e->circleStyle)
+          this->circleBatch.Add(pos, e->circleRadius, *e->circleStyle);
+        else
+          this->worldBatch.Add(e->mesh, pos, e->body->GetAngle());
+        this->cullingStats.drawn++;
+      }
+      else
+        this->cullingStats.culled++;
+    }
+
+  this->circleBatch.Draw();
+  this->worldBatch.Draw();
 
-  // Count this frame.
-  if (!this->paused)
+  renderer->EndWorldPass();
+  this->renderScale = renderer->GetRenderScale();
+
+  // Count this frame. The FPS is measured in real time, whatever the
+  // time scale.
+  if (!this->paused) {
     this->frameCount++;
 
-  for (auto w : this->widgets)
-    w->Render(renderer);
+    Uint64 now = SDL_GetPerformanceCounter();
+    Uint64 frequency = SDL_GetPerformanceFrequency();
+    if (now - this->fpsStart >= frequency) {
+      this->fps = (int) (this->frameCount * frequency / (now - this->fpsStart));
+      this->frameCount = 0;
+      this->fpsStart = now;
+      this->UpdateFpsLabel();
+    }
+  }
+
+  this->RenderWidgets(renderer);
 
   renderer->PresentScreen();
 }
 
+void GameScreen::SetTimeScale(float scale) {
+  this->timeScale = min(max(scale, Config::MinTimeScale), Config::MaxTimeScale);
+
+  // The game timer (time remaining, spawning) runs at the same speed
+  // as the simulation.
+  Timer::SetTimeScale(this->timeScale);
+  cout << "Time scale: " << this->timeScale << "x" << endl;
+}
+
+float GameScreen::GetTimeScale() const {
+  return this->timeScale;
+}
+
+const PhysicsStats &GameScreen::GetPhysicsStats() const {
+  return this->physicsStats;
+}
+
+bool GameScreen::IsAnimating() const {
+  // Nothing moves while paused, except when single-stepping.
+  return !this->paused || this->stepOnce;
+}
+
+const CullingStats &GameScreen::GetCullingStats() const {
+  return this->cullingStats;
+}
+
 void GameScreen::FixCamera() {
+  int winw, winh;
+  SDL_GetWindowSize(this->window, &winw, &winh);
+  this->FixCamera(winw, winh);
+}
+
+void GameScreen::FixCamera(int winw, int winh) {
   for (auto e : this->entities)
     if (e->isPlanet)
-      this->FixCamera(e);
+      this->FixCamera(e, winw, winh);
 }
 
-void GameScreen::FixCamera(Entity *e) {
-  int winw, winh;
-  SDL_GetWindowSize(this->window, &winw, &winh);
+void GameScreen::FixCamera(Entity *e, int winw, int winh) {
   float32 ratio = ((float32) winw) / winh;
 
   float32 width, height;
@@ -906,18 +1030,6 @@ void GameScreen::FixCamera(Entity *e) {
   this->camera.pos.y = - (height / 2.0);
 
   this->camera.ppm = winw / width;
-
-  auto program = ResourceCache::texturedPolygonProgram;
-
-  glUseProgram(program);
-
-  GLuint cameraPosUniform = glGetUniformLocation(program, "camera_pos");
-  GLuint ppmUniform = glGetUniformLocation(program, "ppm");
-
-  glUniform2f(cameraPosUniform, this->camera.pos.x, this->camera.pos.y);
-  glUniform1f(ppmUniform, this->camera.ppm);
-
-  glUseProgram(0);
 }
 
 void GameScreen::UpdateTrails() {
@@ -1001,10 +1113,31 @@ void GameScreen::AddRandomEnemy() {
                                                    angle));
 }
 
+void GameScreen::UpdateFpsLabel() {
+#ifndef RELEASE_BUILD
+  stringstream ss;
+  // Also show how many objects were drawn and culled.
+  ss << "FPS: " << this->fps << " ("
+     << this->cullingStats.drawn << "/" << this->cullingStats.culled << ")";
+  // And the time scale and dropped simulation time, if any.
+  if (this->timeScale != 1.0)
+    ss << " x" << this->timeScale;
+  if (this->physicsStats.droppedTime > 0.0)
+    ss << " dropped: " << (int) (this->physicsStats.droppedTime * 1000) << "ms";
+  // And the resolution the world is drawn at, if reduced.
+  if (this->renderScale < 1.0)
+    ss << " res: " << (int) (this->renderScale * 100) << "%";
+  this->fpsLabel->SetText(ss.str());
+#endif
+}
+
 void GameScreen::TimerCallback(float elapsed) {
   if (this->gameOverLabel->GetVisible()) {
-    this->state["name"] = "game-over";
-    this->state["score"] = to_string(this->score);
+    // Nothing happens after the game is over, so the timer is not
+    // needed any more.
+    this->over = true;
+    this->timer.Stop();
+    this->Finish(TransitionType::GAME_OVER, {this->score});
     return;
   }
 
@@ -1014,15 +1147,6 @@ void GameScreen::TimerCallback(float elapsed) {
       if (e->body->GetPosition().LengthSquared() > pow(Config::CameraMaxWidth / 2.0, 2) + pow(Config::CameraMaxHeight / 2.0, 2) + 25.0)
         this->toBeRemoved.push_back(e);
 
-  // Update FPS counter.
-  this->fps = this->frameCount;
-#ifndef RELEASE_BUILD
-    stringstream ss;
-    ss << "FPS: " << this->fps;
-    this->fpsLabel->SetText(ss.str());
-#endif
-  this->frameCount = 0;
-
   // Decrement remaining time.
   if (this->timeRemaining > 0)
     this->SetTimeRemaining(this->timeRemaining - 1);
@@ -1060,7 +1184,7 @@ void GameScreen::DrawGrid(Renderer *renderer) const {
   renderer->DrawLine(b2Vec2(this->camera.pos.x, y), b2Vec2(upperx, y), 32, 32, 32, 255);*/
 }
 
-void GameScreen::DrawTrail(Renderer *renderer, const Entity *e) const {
+void GameScreen::DrawTrail(const Entity *e) {
   vector<TrailPoint> points;
 
   if (!e->hasTrail)
@@ -1121,8 +1245,7 @@ void GameScreen::DrawTrail(Renderer *renderer, const Entity *e) const {
 
   for (auto &p : points) {
     float scale_factor = r / e->body->GetFixtureList()->GetShape()->m_radius;
-    this->trailPointMesh->SetColor(1.0, 1.0, 1.0, a);
-    this->trailPointMesh->Draw(p.pos, 0.0f, scale_factor);
+    this->circleBatch.Add(p.pos, TrailPointSize * scale_factor, TrailPointStyle, a);
     r += dr;
     a += da;
   }
@@ -9,6 +9,7 @@
 #include "number-widget.hh"
 #include "image-button-widget.hh"
 #include "mesh.hh"
+#include "circle.hh"
 
 #include <SDL2/SDL_mixer.h>
 #include <Box2D/Box2D.h>
@@ -39,9 +40,25 @@ public:
   bool ShouldCollide(b2Fixture *fixtureA, b2Fixture *fixtureB);
 };
 
+/// How many objects (entities and trails) the last rendered frame
+/// submitted for drawing and how many it skipped as not visible.
+struct CullingStats {
+  int drawn;
+  int culled;
+};
+
+/// Physics stepping figures, mostly useful while fast-forwarding or
+/// after stalls.
+struct PhysicsStats {
+  int steps;           // physics steps taken in the last frame
+  int droppedFrames;   // frames that hit the step cap
+  float32 droppedTime; // total simulation time dropped, in seconds
+};
+
 class GameScreen : public Screen {
 protected:
   // state variables
+  bool over;
   float32 time;
   int score;
   int timeRemaining;
@@ -63,9 +80,15 @@ protected:
   ContactFilter contactFilter;
   Entity *sun;
   int frameCount;
+  Uint64 fpsStart;
   int fps;
+  CullingStats cullingStats;
+  PhysicsStats physicsStats;
+  float timeScale;
+  float renderScale;
   vector<Entity*> toBeRemoved;
-  Mesh *trailPointMesh;
+  MeshBatch worldBatch;
+  CircleBatch circleBatch;
   Background background;
   bool mouseDown;
   int mouseDownX;
@@ -86,8 +109,10 @@ protected:
 
   // methods
   void FixCamera();
-  void FixCamera(Entity *e);
+  void FixCamera(int winw, int winh);
+  void FixCamera(Entity *e, int winw, int winh);
   void TimerCallback(float elapsed);
+  void UpdateFpsLabel();
   void UpdateTrails();
   void AddRandomCollectible();
   void AddRandomEnemy();
@@ -100,7 +125,7 @@ protected:
   void DiscardPlanet(Entity *planet);
 
   void DrawGrid(Renderer *renderer) const;
-  void DrawTrail(Renderer *renderer, const Entity *entity) const;
+  void DrawTrail(const Entity *entity);
 
   friend class ContactListener;
 
@@ -108,7 +133,7 @@ public:
   GameScreen(SDL_Window *window);
   virtual ~GameScreen();
 
-  virtual void SwitchScreen(const map<string, string> &lastState);
+  virtual void SwitchScreen(const Transition &from);
   void HandleWidgetEvent(int event_type, Widget *widget);
   virtual void HandleEvent(const SDL_Event &e);
 
@@ -118,6 +143,15 @@ public:
 
   virtual void Advance(float dt);
   virtual void Render(Renderer *renderer);
+  virtual bool IsAnimating() const;
+
+  /// Runs the simulation and the game timer faster or slower than
+  /// real time, for testing. Clamped to the range allowed by Config.
+  void SetTimeScale(float scale);
+  float GetTimeScale() const;
+
+  const CullingStats &GetCullingStats() const;
+  const PhysicsStats &GetPhysicsStats() const;
 };
 
 #endif /* _GRAVITY_GAME_SCREEN_HH_ */
@@ -0,0 +1,292 @@
+#!/usr/bin/env python3
+#
+# Generates gl-loader.hh and gl-loader.cc, a loader for the OpenGL
+# functions the game actually uses.
+#
+# The sources are scanned for gl* functions, GL_* constants and
+# GLLoader:: version and extension flags; only those are taken from the
+# Khronos core profile header. Functions up to REQUIRED_VERSION must be
+# present, the rest may be missing, in which case the flag for their
+# version is false.
+#
+# Usage: gen-gl-loader.py [path to glcorearb.h]
+#
+# Run it again after using a function or constant that is not in
+# gl-loader.hh yet.
+
+import glob
+import os
+import re
+import sys
+
+REQUIRED_VERSION = (3, 3)
+
+# Needed by the loader itself.
+BOOTSTRAP_FUNCTIONS = {'glGetString', 'glGetStringi', 'glGetIntegerv'}
+BOOTSTRAP_CONSTANTS = {'GL_VERSION', 'GL_EXTENSIONS', 'GL_NUM_EXTENSIONS'}
+
+# The header's platform-specific integer types, as standard ones.
+KHRONOS_TYPES = {
+    'khronos_float_t': 'float',
+    'khronos_int8_t': 'int8_t',
+    'khronos_uint8_t': 'uint8_t',
+    'khronos_int16_t': 'int16_t',
+    'khronos_uint16_t': 'uint16_t',
+    'khronos_int32_t': 'int32_t',
+    'khronos_uint32_t': 'uint32_t',
+    'khronos_int64_t': 'int64_t',
+    'khronos_uint64_t': 'uint64_t',
+    'khronos_intptr_t': 'intptr_t',
+    'khronos_ssize_t': 'ptrdiff_t',
+}
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+def parse_header(path):
+    """Returns the types, constants and functions of the header, with
+    the version or extension block each function is declared in."""
+    types = []
+    constants = {}
+    functions = {}
+    block = None
+
+    lines = open(path).read().split('\n')
+    for i, line in enumerate(lines):
+        m = re.match(r'#ifndef (GL_\w+)$', line)
+        if m and i + 1 < len(lines) and lines[i + 1] == '#define %s 1' % m.group(1):
+            block = m.group(1)
+            continue
+
+        if line.startswith('#endif /* GL_'):
+            block = None
+            continue
+
+        # Basic types come from the core version blocks only.
+        if line.startswith('typedef') and 'PFN' not in line and block and block.startswith('GL_VERSION_'):
+            for k, v in KHRONOS_TYPES.items():
+                line = re.sub(r'\b%s\b' % k, v, line)
+            types.append(line)
+            continue
+
+        m = re.match(r'#define (GL_\w+)\s+(\S+)$', line)
+        if m:
+            name, value = m.groups()
+            if name != block and name not in constants:
+                constants[name] = value
+            continue
+
+        m = re.match(r'GLAPI (.+?)\s*APIENTRY (gl\w+) \((.*)\);$', line)
+        if m and m.group(2) not in functions:
+            functions[m.group(2)] = (m.group(1), m.group(3), block)
+
+    return types, constants, functions
+
+
+def scan_sources():
+    """Returns the functions, constants and flags used by the sources."""
+    names = set()
+    flags = set()
+
+    paths = glob.glob(os.path.join(HERE, '*.cc')) + glob.glob(os.path.join(HERE, '*.hh'))
+    paths += glob.glob(os.path.join(HERE, 'posix', '*.cc')) + glob.glob(os.path.join(HERE, 'windows', '*.cc'))
+    for path in paths:
+        if os.path.basename(path).startswith('gl-loader.'):
+            continue
+
+        text = open(path).read()
+        names.update(re.findall(r'\b(gl[A-Z]\w*|GL_\w+)\b', text))
+        flags.update(re.findall(r'\bGLLoader::(VERSION_\d_\d|[A-Z0-9]+_[A-Za-z0-9_]+)\b', text))
+
+    return names, flags
+
+
+def block_version(block):
+    m = re.match(r'GL_VERSION_(\d)_(\d)$', block or '')
+    return (int(m.group(1)), int(m.group(2))) if m else None
+
+
+def main():
+    header = sys.argv[1] if len(sys.argv) > 1 else '/usr/include/GL/glcorearb.h'
+    types, constants, functions = parse_header(header)
+    names, flags = scan_sources()
+
+    used_functions = sorted(n for n in names | BOOTSTRAP_FUNCTIONS if n in functions)
+    used_constants = sorted(n for n in names | BOOTSTRAP_CONSTANTS if n in constants)
+    versions = sorted(f for f in flags if f.startswith('VERSION_'))
+    extensions = sorted(f for f in flags if not f.startswith('VERSION_'))
+
+    unknown = sorted(n for n in names if n not in functions and n not in constants and n.startswith('gl'))
+    for n in unknown:
+        print('warning: %s not found in %s' % (n, header))
+
+    hh = []
+    hh.append('// Generated by gen-gl-loader.py from glcorearb.h; do not edit.')
+    hh.append('')
+    hh.append('#ifndef _GRAVITY_GL_LOADER_HH_')
+    hh.append('#define _GRAVITY_GL_LOADER_HH_')
+    hh.append('')
+    hh.append('#if defined(__gl_h_) || defined(__GL_H__) || defined(__gl_glcorearb_h_) || defined(__gl_glext_h_)')
+    hh.append('#error gl-loader.hh must be included before any other OpenGL header')
+    hh.append('#endif')
+    hh.append('')
+    hh.append('// Keep the system OpenGL headers out so that only these declarations are seen.')
+    hh.append('#define __gl_h_')
+    hh.append('#define __GL_H__')
+    hh.append('#define __gl_glcorearb_h_')
+    hh.append('#define __gl_glext_h_')
+    hh.append('#define __glext_h_')
+    hh.append('')
+    hh.append('#if defined(_WIN32) && !defined(APIENTRY) && !defined(__CYGWIN__)')
+    hh.append('#ifndef WIN32_LEAN_AND_MEAN')
+    hh.append('#define WIN32_LEAN_AND_MEAN 1')
+    hh.append('#endif')
+    hh.append('#include <windows.h>')
+    hh.append('#endif')
+    hh.append('#ifndef APIENTRY')
+    hh.append('#define APIENTRY')
+    hh.append('#endif')
+    hh.append('#define APIENTRYP APIENTRY *')
+    hh.append('#define GLAPIENTRY APIENTRY')
+    hh.append('')
+    hh.append('#include <cstddef>')
+    hh.append('#include <cstdint>')
+    hh.append('#include <string>')
+    hh.append('')
+    hh.extend(types)
+    hh.append('')
+    for n in used_constants:
+        hh.append('#define %s %s' % (n, constants[n]))
+    hh.append('')
+    for n in used_functions:
+        ret, params, block = functions[n]
+        hh.append('typedef %s (APIENTRYP PFN%sPROC) (%s);' % (ret, n.upper(), params))
+    hh.append('')
+    for n in used_functions:
+        hh.append('extern PFN%sPROC gravity_%s;' % (n.upper(), n))
+        hh.append('#define %s gravity_%s' % (n, n))
+    hh.append('')
+    hh.append('namespace GLLoader {')
+    hh.append('')
+    hh.append('/// Whether the context supports the given version, and provides the')
+    hh.append('/// functions of that version the game uses.')
+    for v in versions:
+        hh.append('extern bool %s;' % v)
+    hh.append('')
+    hh.append('/// Whether the driver reports the given extension.')
+    for e in extensions:
+        hh.append('extern bool %s;' % e)
+    hh.append('')
+    hh.append('/// Resolves the functions for the current context. Returns false, with')
+    hh.append('/// a message listing what is missing, if the context is older than')
+    hh.append('/// OpenGL %d.%d or lacks any of its functions.' % REQUIRED_VERSION)
+    hh.append('extern bool Init(std::string &error);')
+    hh.append('')
+    hh.append('} // namespace GLLoader')
+    hh.append('')
+    hh.append('#endif /* _GRAVITY_GL_LOADER_HH_ */')
+
+    cc = []
+    cc.append('// Generated by gen-gl-loader.py from glcorearb.h; do not edit.')
+    cc.append('')
+    cc.append('#include "gl-loader.hh"')
+    cc.append('')
+    cc.append('#include <SDL2/SDL.h>')
+    cc.append('')
+    cc.append('#include <cstdio>')
+    cc.append('#include <cstring>')
+    cc.append('#include <sstream>')
+    cc.append('')
+    cc.append('using namespace std;')
+    cc.append('')
+    for n in used_functions:
+        cc.append('PFN%sPROC gravity_%s = nullptr;' % (n.upper(), n))
+    cc.append('')
+    cc.append('namespace GLLoader {')
+    cc.append('')
+    for f in versions + extensions:
+        cc.append('bool %s = false;' % f)
+    cc.append('')
+    cc.append('// A function, and the version it is part of; zero for extensions.')
+    cc.append('struct FunctionInfo {')
+    cc.append('  const char *name;')
+    cc.append('  const void *pointer;')
+    cc.append('  int major;')
+    cc.append('  int minor;')
+    cc.append('};')
+    cc.append('')
+    cc.append('bool Init(string &error) {')
+    for n in used_functions:
+        cc.append('  gravity_%s = (PFN%sPROC) SDL_GL_GetProcAddress("%s");' % (n, n.upper(), n))
+    cc.append('')
+    cc.append('  const FunctionInfo functions[] = {')
+    for n in used_functions:
+        v = block_version(functions[n][2]) or (0, 0)
+        cc.append('    {"%s", (const void*) gravity_%s, %d, %d},' % (n, n, v[0], v[1]))
+    cc.append('  };')
+    cc.append('')
+    cc.append('  int major = 0, minor = 0;')
+    cc.append('  const char *version = gravity_glGetString ? (const char*) glGetString(GL_VERSION) : nullptr;')
+    cc.append('  if (version == nullptr || sscanf(version, "%d.%d", &major, &minor) != 2) {')
+    cc.append('    error = "Could not get the OpenGL version.";')
+    cc.append('    return false;')
+    cc.append('  }')
+    cc.append('')
+    cc.append('  if (major < %d || (major == %d && minor < %d)) {' % (REQUIRED_VERSION[0], REQUIRED_VERSION[0], REQUIRED_VERSION[1]))
+    cc.append('    error = string("OpenGL %d.%d not found; the driver provides ") + version + ".";' % REQUIRED_VERSION)
+    cc.append('    return false;')
+    cc.append('  }')
+    cc.append('')
+    cc.append('  // Required functions are reported all at once; any others only')
+    cc.append('  // disable the version they belong to.')
+    cc.append('  stringstream missing;')
+    cc.append('  for (auto &f : functions) {')
+    cc.append('    if (f.pointer == nullptr && f.major > 0 &&')
+    cc.append('        (f.major < %d || (f.major == %d && f.minor <= %d)))' % (REQUIRED_VERSION[0], REQUIRED_VERSION[0], REQUIRED_VERSION[1]))
+    cc.append('      missing << " " << f.name;')
+    cc.append('  }')
+    cc.append('')
+    cc.append('  if (!missing.str().empty()) {')
+    cc.append('    error = "Missing OpenGL functions:" + missing.str() + ".";')
+    cc.append('    return false;')
+    cc.append('  }')
+    cc.append('')
+    cc.append('  auto hasVersion = [&](int vmajor, int vminor) {')
+    cc.append('    if (major < vmajor || (major == vmajor && minor < vminor))')
+    cc.append('      return false;')
+    cc.append('')
+    cc.append('    for (auto &f : functions) {')
+    cc.append('      if (f.pointer == nullptr && f.major == vmajor && f.minor == vminor)')
+    cc.append('        return false;')
+    cc.append('    }')
+    cc.append('')
+    cc.append('    return true;')
+    cc.append('  };')
+    cc.append('')
+    for v in versions:
+        a, b = v[len('VERSION_'):].split('_')
+        cc.append('  %s = hasVersion(%s, %s);' % (v, a, b))
+    if extensions:
+        cc.append('')
+        cc.append('  // Only the extensions the game checks for are looked up.')
+        cc.append('  GLint count = 0;')
+        cc.append('  glGetIntegerv(GL_NUM_EXTENSIONS, &count);')
+        cc.append('  for (GLint i = 0; i < count; ++i) {')
+        cc.append('    const char *name = (const char*) glGetStringi(GL_EXTENSIONS, i);')
+        for i, e in enumerate(extensions):
+            cc.append('    %sif (strcmp(name, "GL_%s") == 0)' % ('' if i == 0 else 'else ', e))
+            cc.append('      %s = true;' % e)
+        cc.append('  }')
+    cc.append('')
+    cc.append('  return true;')
+    cc.append('}')
+    cc.append('')
+    cc.append('} // namespace GLLoader')
+
+    open(os.path.join(HERE, 'gl-loader.hh'), 'w').write('\n'.join(hh) + '\n')
+    open(os.path.join(HERE, 'gl-loader.cc'), 'w').write('\n'.join(cc) + '\n')
+    print('%d functions, %d constants' % (len(used_functions), len(used_constants)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,168 @@
+#include "gl-diagnostics.hh"
+
+#include <SDL2/SDL.h>
+
+#include <iostream>
+#include <map>
+#include <utility>
+
+using namespace std;
+
+namespace GLDiagnostics {
+
+// Maximum number of times the same message is printed.
+const int MAX_REPEATS = 5;
+
+// Maximum number of messages printed per second, all ids included.
+const int MAX_MESSAGES_PER_SECOND = 20;
+
+bool debugOutput = false;
+GLenum sourceFilter = GL_DONT_CARE;
+GLenum severityFilter = GL_DEBUG_SEVERITY_LOW;
+
+// Keyed by (source, id). Errors from glGetError use source 0, so that
+// error codes and debug message ids are counted apart.
+map<pair<GLenum, GLuint>, int> repeatCounts;
+Uint32 windowStart = 0;
+int windowCount = 0;
+int windowSuppressed = 0;
+
+const char *SourceName(GLenum source) {
+  switch (source) {
+  case GL_DEBUG_SOURCE_API: return "api";
+  case GL_DEBUG_SOURCE_WINDOW_SYSTEM: return "window-system";
+  case GL_DEBUG_SOURCE_SHADER_COMPILER: return "shader-compiler";
+  case GL_DEBUG_SOURCE_THIRD_PARTY: return "third-party";
+  case GL_DEBUG_SOURCE_APPLICATION: return "application";
+  default: return "other";
+  }
+}
+
+const char *TypeName(GLenum type) {
+  switch (type) {
+  case GL_DEBUG_TYPE_ERROR: return "error";
+  case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "deprecated";
+  case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: return "undefined";
+  case GL_DEBUG_TYPE_PORTABILITY: return "portability";
+  case GL_DEBUG_TYPE_PERFORMANCE: return "performance";
+  default: return "other";
+  }
+}
+
+const char *SeverityName(GLenum severity) {
+  switch (severity) {
+  case GL_DEBUG_SEVERITY_HIGH: return "high";
+  case GL_DEBUG_SEVERITY_MEDIUM: return "medium";
+  case GL_DEBUG_SEVERITY_LOW: return "low";
+  default: return "notification";
+  }
+}
+
+// Returns true if the message should be printed, taking both the
+// per-message and the global limits into account.
+bool RateLimit(GLenum source, GLuint id) {
+  Uint32 now = SDL_GetTicks();
+  if (now - windowStart >= 1000) {
+    if (windowSuppressed > 0)
+      cout << "gl: " << windowSuppressed << " message(s) suppressed." << endl;
+
+    windowStart = now;
+    windowCount = 0;
+    windowSuppressed = 0;
+  }
+
+  int &repeats = repeatCounts[make_pair(source, id)];
+  if (repeats > MAX_REPEATS)
+    return false;
+
+  if (windowCount >= MAX_MESSAGES_PER_SECOND) {
+    windowSuppressed++;
+    return false;
+  }
+
+  repeats++;
+  windowCount++;
+
+  if (repeats > MAX_REPEATS) {
+    cout << "gl: message " << id << " repeated too often; ignoring from now on." << endl;
+    return false;
+  }
+
+  return true;
+}
+
+void GLAPIENTRY DebugCallback(GLenum source, GLenum type, GLuint id, GLenum severity,
+                              GLsizei length, const GLchar *message, const void *userParam)
+{
+  (void) length;
+  (void) userParam;
+
+  if (!RateLimit(source, id))
+    return;
+
+  cout << "gl: [" << SourceName(source) << "/" << TypeName(type) << "/"
+       << SeverityName(severity) << "] (" << id << ") " << message << endl;
+}
+
+void ApplyFilter() {
+  // Turn everything off and then turn on the accepted severities,
+  // from the most severe down to the minimum requested.
+  glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, GL_FALSE);
+
+  const GLenum severities[] = {GL_DEBUG_SEVERITY_HIGH,
+                               GL_DEBUG_SEVERITY_MEDIUM,
+                               GL_DEBUG_SEVERITY_LOW,
+                               GL_DEBUG_SEVERITY_NOTIFICATION};
+  for (auto s : severities) {
+    glDebugMessageControl(sourceFilter, GL_DONT_CARE, s, 0, nullptr, GL_TRUE);
+    if (s == severityFilter)
+      break;
+  }
+}
+
+void Init() {
+#ifndef RELEASE_BUILD
+  if (!GLLoader::KHR_debug && !GLLoader::VERSION_4_3) {
+    cout << "gl: KHR_debug not available; falling back to glGetError checks." << endl;
+    return;
+  }
+
+  GLint flags;
+  glGetIntegerv(GL_CONTEXT_FLAGS, &flags);
+  if (!(flags & GL_CONTEXT_FLAG_DEBUG_BIT))
+    cout << "gl: not a debug context; driver messages may be incomplete." << endl;
+
+  glEnable(GL_DEBUG_OUTPUT);
+
+  // Report messages on the offending call so a debugger breakpoint in
+  // the callback shows where they came from.
+  glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+
+  glDebugMessageCallback(DebugCallback, nullptr);
+  ApplyFilter();
+
+  debugOutput = true;
+#endif
+}
+
+void SetFilter(GLenum source, GLenum minSeverity) {
+  sourceFilter = source;
+  severityFilter = minSeverity;
+
+  if (debugOutput)
+    ApplyFilter();
+}
+
+bool HasDebugOutput() {
+  return debugOutput;
+}
+
+void Check(const char *where) {
+  GLenum err;
+  while ((err = glGetError()) != GL_NO_ERROR) {
+    if (RateLimit(0, err))
+      cout << where << ": OpenGL error 0x" << hex << err << dec << "." << endl;
+  }
+}
+
+} // namespace GLDiagnostics
@@ -0,0 +1,42 @@
+#ifndef _GRAVITY_GL_DIAGNOSTICS_HH_
+#define _GRAVITY_GL_DIAGNOSTICS_HH_
+
+#include "gl-loader.hh"
+
+namespace GLDiagnostics {
+
+/// Installs the KHR_debug message callback, if the driver offers
+/// one. Must be called after the OpenGL context has been created. In
+/// release builds this does nothing.
+extern void Init();
+
+/// Restricts the messages reported by the debug callback to the
+/// given source (GL_DONT_CARE for all sources) and to those at least
+/// as severe as `minSeverity`.
+extern void SetFilter(GLenum source, GLenum minSeverity);
+
+/// Returns true if errors are being reported through the debug
+/// callback, in which case explicit checks are unnecessary.
+extern bool HasDebugOutput();
+
+/// Polls glGetError and reports any pending errors, tagged with
+/// `where`. Only used as a fallback when there is no debug output.
+extern void Check(const char *where);
+
+} // namespace GLDiagnostics
+
+// GL_CHECK is meant for the places that used to call glGetError
+// directly. In release builds it compiles to nothing; in debug builds
+// it only polls the error state when the debug callback could not be
+// installed.
+#ifdef RELEASE_BUILD
+#define GL_CHECK(where) ((void) 0)
+#else
+#define GL_CHECK(where)                         \
+  do {                                          \
+    if (!GLDiagnostics::HasDebugOutput())       \
+      GLDiagnostics::Check(where);              \
+  } while (0)
+#endif
+
+#endif /* _GRAVITY_GL_DIAGNOSTICS_HH_ */
@@ -0,0 +1,317 @@
+// Generated by gen-gl-loader.py from glcorearb.h; do not edit.
+
+#include "gl-loader.hh"
+
+#include <SDL2/SDL.h>
+
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+using namespace std;
+
+PFNGLACTIVETEXTUREPROC gravity_glActiveTexture = nullptr;
+PFNGLATTACHSHADERPROC gravity_glAttachShader = nullptr;
+PFNGLBEGINQUERYPROC gravity_glBeginQuery = nullptr;
+PFNGLBINDBUFFERPROC gravity_glBindBuffer = nullptr;
+PFNGLBINDBUFFERBASEPROC gravity_glBindBufferBase = nullptr;
+PFNGLBINDFRAMEBUFFERPROC gravity_glBindFramebuffer = nullptr;
+PFNGLBINDTEXTUREPROC gravity_glBindTexture = nullptr;
+PFNGLBLENDFUNCPROC gravity_glBlendFunc = nullptr;
+PFNGLBLITFRAMEBUFFERPROC gravity_glBlitFramebuffer = nullptr;
+PFNGLBUFFERDATAPROC gravity_glBufferData = nullptr;
+PFNGLBUFFERSUBDATAPROC gravity_glBufferSubData = nullptr;
+PFNGLCHECKFRAMEBUFFERSTATUSPROC gravity_glCheckFramebufferStatus = nullptr;
+PFNGLCLEARPROC gravity_glClear = nullptr;
+PFNGLCLEARCOLORPROC gravity_glClearColor = nullptr;
+PFNGLCLIENTWAITSYNCPROC gravity_glClientWaitSync = nullptr;
+PFNGLCOMPILESHADERPROC gravity_glCompileShader = nullptr;
+PFNGLCREATEPROGRAMPROC gravity_glCreateProgram = nullptr;
+PFNGLCREATESHADERPROC gravity_glCreateShader = nullptr;
+PFNGLDEBUGMESSAGECALLBACKPROC gravity_glDebugMessageCallback = nullptr;
+PFNGLDEBUGMESSAGECONTROLPROC gravity_glDebugMessageControl = nullptr;
+PFNGLDELETEBUFFERSPROC gravity_glDeleteBuffers = nullptr;
+PFNGLDELETEFRAMEBUFFERSPROC gravity_glDeleteFramebuffers = nullptr;
+PFNGLDELETEPROGRAMPROC gravity_glDeleteProgram = nullptr;
+PFNGLDELETEQUERIESPROC gravity_glDeleteQueries = nullptr;
+PFNGLDELETESHADERPROC gravity_glDeleteShader = nullptr;
+PFNGLDELETESYNCPROC gravity_glDeleteSync = nullptr;
+PFNGLDELETETEXTURESPROC gravity_glDeleteTextures = nullptr;
+PFNGLDISABLEVERTEXATTRIBARRAYPROC gravity_glDisableVertexAttribArray = nullptr;
+PFNGLDRAWARRAYSPROC gravity_glDrawArrays = nullptr;
+PFNGLDRAWARRAYSINSTANCEDPROC gravity_glDrawArraysInstanced = nullptr;
+PFNGLENABLEPROC gravity_glEnable = nullptr;
+PFNGLENABLEVERTEXATTRIBARRAYPROC gravity_glEnableVertexAttribArray = nullptr;
+PFNGLENDQUERYPROC gravity_glEndQuery = nullptr;
+PFNGLFENCESYNCPROC gravity_glFenceSync = nullptr;
+PFNGLFINISHPROC gravity_glFinish = nullptr;
+PFNGLFRAMEBUFFERTEXTURE2DPROC gravity_glFramebufferTexture2D = nullptr;
+PFNGLGENBUFFERSPROC gravity_glGenBuffers = nullptr;
+PFNGLGENFRAMEBUFFERSPROC gravity_glGenFramebuffers = nullptr;
+PFNGLGENQUERIESPROC gravity_glGenQueries = nullptr;
+PFNGLGENTEXTURESPROC gravity_glGenTextures = nullptr;
+PFNGLGENERATEMIPMAPPROC gravity_glGenerateMipmap = nullptr;
+PFNGLGETATTRIBLOCATIONPROC gravity_glGetAttribLocation = nullptr;
+PFNGLGETERRORPROC gravity_glGetError = nullptr;
+PFNGLGETFLOATVPROC gravity_glGetFloatv = nullptr;
+PFNGLGETINTEGERVPROC gravity_glGetIntegerv = nullptr;
+PFNGLGETPROGRAMBINARYPROC gravity_glGetProgramBinary = nullptr;
+PFNGLGETPROGRAMINFOLOGPROC gravity_glGetProgramInfoLog = nullptr;
+PFNGLGETPROGRAMIVPROC gravity_glGetProgramiv = nullptr;
+PFNGLGETQUERYOBJECTIVPROC gravity_glGetQueryObjectiv = nullptr;
+PFNGLGETQUERYOBJECTUI64VPROC gravity_glGetQueryObjectui64v = nullptr;
+PFNGLGETSHADERINFOLOGPROC gravity_glGetShaderInfoLog = nullptr;
+PFNGLGETSHADERIVPROC gravity_glGetShaderiv = nullptr;
+PFNGLGETSTRINGPROC gravity_glGetString = nullptr;
+PFNGLGETSTRINGIPROC gravity_glGetStringi = nullptr;
+PFNGLGETTEXLEVELPARAMETERIVPROC gravity_glGetTexLevelParameteriv = nullptr;
+PFNGLGETUNIFORMBLOCKINDEXPROC gravity_glGetUniformBlockIndex = nullptr;
+PFNGLGETUNIFORMLOCATIONPROC gravity_glGetUniformLocation = nullptr;
+PFNGLLINKPROGRAMPROC gravity_glLinkProgram = nullptr;
+PFNGLMAPBUFFERRANGEPROC gravity_glMapBufferRange = nullptr;
+PFNGLPIXELSTOREIPROC gravity_glPixelStorei = nullptr;
+PFNGLPROGRAMBINARYPROC gravity_glProgramBinary = nullptr;
+PFNGLPROGRAMPARAMETERIPROC gravity_glProgramParameteri = nullptr;
+PFNGLREADPIXELSPROC gravity_glReadPixels = nullptr;
+PFNGLSHADERSOURCEPROC gravity_glShaderSource = nullptr;
+PFNGLTEXIMAGE2DPROC gravity_glTexImage2D = nullptr;
+PFNGLTEXPARAMETERIPROC gravity_glTexParameteri = nullptr;
+PFNGLUNIFORM1IPROC gravity_glUniform1i = nullptr;
+PFNGLUNIFORMBLOCKBINDINGPROC gravity_glUniformBlockBinding = nullptr;
+PFNGLUNMAPBUFFERPROC gravity_glUnmapBuffer = nullptr;
+PFNGLUSEPROGRAMPROC gravity_glUseProgram = nullptr;
+PFNGLVERTEXATTRIB1FPROC gravity_glVertexAttrib1f = nullptr;
+PFNGLVERTEXATTRIB2FPROC gravity_glVertexAttrib2f = nullptr;
+PFNGLVERTEXATTRIB4FPROC gravity_glVertexAttrib4f = nullptr;
+PFNGLVERTEXATTRIBDIVISORPROC gravity_glVertexAttribDivisor = nullptr;
+PFNGLVERTEXATTRIBPOINTERPROC gravity_glVertexAttribPointer = nullptr;
+PFNGLVIEWPORTPROC gravity_glViewport = nullptr;
+
+namespace GLLoader {
+
+bool VERSION_4_1 = false;
+bool VERSION_4_3 = false;
+bool ARB_get_program_binary = false;
+bool KHR_debug = false;
+
+// A function, and the version it is part of; zero for extensions.
+struct FunctionInfo {
+  const char *name;
+  const void *pointer;
+  int major;
+  int minor;
+};
+
+bool Init(string &error) {
+  gravity_glActiveTexture = (PFNGLACTIVETEXTUREPROC) SDL_GL_GetProcAddress("glActiveTexture");
+  gravity_glAttachShader = (PFNGLATTACHSHADERPROC) SDL_GL_GetProcAddress("glAttachShader");
+  gravity_glBeginQuery = (PFNGLBEGINQUERYPROC) SDL_GL_GetProcAddress("glBeginQuery");
+  gravity_glBindBuffer = (PFNGLBINDBUFFERPROC) SDL_GL_GetProcAddress("glBindBuffer");
+  gravity_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC) SDL_GL_GetProcAddress("glBindBufferBase");
+  gravity_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC) SDL_GL_GetProcAddress("glBindFramebuffer");
+  gravity_glBindTexture = (PFNGLBINDTEXTUREPROC) SDL_GL_GetProcAddress("glBindTexture");
+  gravity_glBlendFunc = (PFNGLBLENDFUNCPROC) SDL_GL_GetProcAddress("glBlendFunc");
+  gravity_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC) SDL_GL_GetProcAddress("glBlitFramebuffer");
+  gravity_glBufferData = (PFNGLBUFFERDATAPROC) SDL_GL_GetProcAddress("glBufferData");
+  gravity_glBufferSubData = (PFNGLBUFFERSUBDATAPROC) SDL_GL_GetProcAddress("glBufferSubData");
+  gravity_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC) SDL_GL_GetProcAddress("glCheckFramebufferStatus");
+  gravity_glClear = (PFNGLCLEARPROC) SDL_GL_GetProcAddress("glClear");
+  gravity_glClearColor = (PFNGLCLEARCOLORPROC) SDL_GL_GetProcAddress("glClearColor");
+  gravity_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC) SDL_GL_GetProcAddress("glClientWaitSync");
+  gravity_glCompileShader = (PFNGLCOMPILESHADERPROC) SDL_GL_GetProcAddress("glCompileShader");
+  gravity_glCreateProgram = (PFNGLCREATEPROGRAMPROC) SDL_GL_GetProcAddress("glCreateProgram");
+  gravity_glCreateShader = (PFNGLCREATESHADERPROC) SDL_GL_GetProcAddress("glCreateShader");
+  gravity_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC) SDL_GL_GetProcAddress("glDebugMessageCallback");
+  gravity_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC) SDL_GL_GetProcAddress("glDebugMessageControl");
+  gravity_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC) SDL_GL_GetProcAddress("glDeleteBuffers");
+  gravity_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC) SDL_GL_GetProcAddress("glDeleteFramebuffers");
+  gravity_glDeleteProgram = (PFNGLDELETEPROGRAMPROC) SDL_GL_GetProcAddress("glDeleteProgram");
+  gravity_glDeleteQueries = (PFNGLDELETEQUERIESPROC) SDL_GL_GetProcAddress("glDeleteQueries");
+  gravity_glDeleteShader = (PFNGLDELETESHADERPROC) SDL_GL_GetProcAddress("glDeleteShader");
+  gravity_glDeleteSync = (PFNGLDELETESYNCPROC) SDL_GL_GetProcAddress("glDeleteSync");
+  gravity_glDeleteTextures = (PFNGLDELETETEXTURESPROC) SDL_GL_GetProcAddress("glDeleteTextures");
+  gravity_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC) SDL_GL_GetProcAddress("glDisableVertexAttribArray");
+  gravity_glDrawArrays = (PFNGLDRAWARRAYSPROC) SDL_GL_GetProcAddress("glDrawArrays");
+  gravity_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC) SDL_GL_GetProcAddress("glDrawArraysInstanced");
+  gravity_glEnable = (PFNGLENABLEPROC) SDL_GL_GetProcAddress("glEnable");
+  gravity_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC) SDL_GL_GetProcAddress("glEnableVertexAttribArray");
+  gravity_glEndQuery = (PFNGLENDQUERYPROC) SDL_GL_GetProcAddress("glEndQuery");
+  gravity_glFenceSync = (PFNGLFENCESYNCPROC) SDL_GL_GetProcAddress("glFenceSync");
+  gravity_glFinish = (PFNGLFINISHPROC) SDL_GL_GetProcAddress("glFinish");
+  gravity_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC) SDL_GL_GetProcAddress("glFramebufferTexture2D");
+  gravity_glGenBuffers = (PFNGLGENBUFFERSPROC) SDL_GL_GetProcAddress("glGenBuffers");
+  gravity_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC) SDL_GL_GetProcAddress("glGenFramebuffers");
+  gravity_glGenQueries = (PFNGLGENQUERIESPROC) SDL_GL_GetProcAddress("glGenQueries");
+  gravity_glGenTextures = (PFNGLGENTEXTURESPROC) SDL_GL_GetProcAddress("glGenTextures");
+  gravity_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC) SDL_GL_GetProcAddress("glGenerateMipmap");
+  gravity_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC) SDL_GL_GetProcAddress("glGetAttribLocation");
+  gravity_glGetError = (PFNGLGETERRORPROC) SDL_GL_GetProcAddress("glGetError");
+  gravity_glGetFloatv = (PFNGLGETFLOATVPROC) SDL_GL_GetProcAddress("glGetFloatv");
+  gravity_glGetIntegerv = (PFNGLGETINTEGERVPROC) SDL_GL_GetProcAddress("glGetIntegerv");
+  gravity_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC) SDL_GL_GetProcAddress("glGetProgramBinary");
+  gravity_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC) SDL_GL_GetProcAddress("glGetProgramInfoLog");
+  gravity_glGetProgramiv = (PFNGLGETPROGRAMIVPROC) SDL_GL_GetProcAddress("glGetProgramiv");
+  gravity_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC) SDL_GL_GetProcAddress("glGetQueryObjectiv");
+  gravity_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC) SDL_GL_GetProcAddress("glGetQueryObjectui64v");
+  gravity_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC) SDL_GL_GetProcAddress("glGetShaderInfoLog");
+  gravity_glGetShaderiv = (PFNGLGETSHADERIVPROC) SDL_GL_GetProcAddress("glGetShaderiv");
+  gravity_glGetString = (PFNGLGETSTRINGPROC) SDL_GL_GetProcAddress("glGetString");
+  gravity_glGetStringi = (PFNGLGETSTRINGIPROC) SDL_GL_GetProcAddress("glGetStringi");
+  gravity_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC) SDL_GL_GetProcAddress("glGetTexLevelParameteriv");
+  gravity_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC) SDL_GL_GetProcAddress("glGetUniformBlockIndex");
+  gravity_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC) SDL_GL_GetProcAddress("glGetUniformLocation");
+  gravity_glLinkProgram = (PFNGLLINKPROGRAMPROC) SDL_GL_GetProcAddress("glLinkProgram");
+  gravity_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC) SDL_GL_GetProcAddress("glMapBufferRange");
+  gravity_glPixelStorei = (PFNGLPIXELSTOREIPROC) SDL_GL_GetProcAddress("glPixelStorei");
+  gravity_glProgramBinary = (PFNGLPROGRAMBINARYPROC) SDL_GL_GetProcAddress("glProgramBinary");
+  gravity_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC) SDL_GL_GetProcAddress("glProgramParameteri");
+  gravity_glReadPixels = (PFNGLREADPIXELSPROC) SDL_GL_GetProcAddress("glReadPixels");
+  gravity_glShaderSource = (PFNGLSHADERSOURCEPROC) SDL_GL_GetProcAddress("glShaderSource");
+  gravity_glTexImage2D = (PFNGLTEXIMAGE2DPROC) SDL_GL_GetProcAddress("glTexImage2D");
+  gravity_glTexParameteri = (PFNGLTEXPARAMETERIPROC) SDL_GL_GetProcAddress("glTexParameteri");
+  gravity_glUniform1i = (PFNGLUNIFORM1IPROC) SDL_GL_GetProcAddress("glUniform1i");
+  gravity_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC) SDL_GL_GetProcAddress("glUniformBlockBinding");
+  gravity_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC) SDL_GL_GetProcAddress("glUnmapBuffer");
+  gravity_glUseProgram = (PFNGLUSEPROGRAMPROC) SDL_GL_GetProcAddress("glUseProgram");
+  gravity_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC) SDL_GL_GetProcAddress("glVertexAttrib1f");
+  gravity_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC) SDL_GL_GetProcAddress("glVertexAttrib2f");
+  gravity_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC) SDL_GL_GetProcAddress("glVertexAttrib4f");
+  gravity_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC) SDL_GL_GetProcAddress("glVertexAttribDivisor");
+  gravity_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC) SDL_GL_GetProcAddress("glVertexAttribPointer");
+  gravity_glViewport = (PFNGLVIEWPORTPROC) SDL_GL_GetProcAddress("glViewport");
+
+  const FunctionInfo functions[] = {
+    {"glActiveTexture", (const void*) gravity_glActiveTexture, 1, 3},
+    {"glAttachShader", (const void*) gravity_glAttachShader, 2, 0},
+    {"glBeginQuery", (const void*) gravity_glBeginQuery, 1, 5},
+    {"glBindBuffer", (const void*) gravity_glBindBuffer, 1, 5},
+    {"glBindBufferBase", (const void*) gravity_glBindBufferBase, 3, 0},
+    {"glBindFramebuffer", (const void*) gravity_glBindFramebuffer, 3, 0},
+    {"glBindTexture", (const void*) gravity_glBindTexture, 1, 1},
+    {"glBlendFunc", (const void*) gravity_glBlendFunc, 1, 0},
+    {"glBlitFramebuffer", (const void*) gravity_glBlitFramebuffer, 3, 0},
+    {"glBufferData", (const void*) gravity_glBufferData, 1, 5},
+    {"glBufferSubData", (const void*) gravity_glBufferSubData, 1, 5},
+    {"glCheckFramebufferStatus", (const void*) gravity_glCheckFramebufferStatus, 3, 0},
+    {"glClear", (const void*) gravity_glClear, 1, 0},
+    {"glClearColor", (const void*) gravity_glClearColor, 1, 0},
+    {"glClientWaitSync", (const void*) gravity_glClientWaitSync, 3, 2},
+    {"glCompileShader", (const void*) gravity_glCompileShader, 2, 0},
+    {"glCreateProgram", (const void*) gravity_glCreateProgram, 2, 0},
+    {"glCreateShader", (const void*) gravity_glCreateShader, 2, 0},
+    {"glDebugMessageCallback", (const void*) gravity_glDebugMessageCallback, 4, 3},
+    {"glDebugMessageControl", (const void*) gravity_glDebugMessageControl, 4, 3},
+    {"glDeleteBuffers", (const void*) gravity_glDeleteBuffers, 1, 5},
+    {"glDeleteFramebuffers", (const void*) gravity_glDeleteFramebuffers, 3, 0},
+    {"glDeleteProgram", (const void*) gravity_glDeleteProgram, 2, 0},
+    {"glDeleteQueries", (const void*) gravity_glDeleteQueries, 1, 5},
+    {"glDeleteShader", (const void*) gravity_glDeleteShader, 2, 0},
+    {"glDeleteSync", (const void*) gravity_glDeleteSync, 3, 2},
+    {"glDeleteTextures", (const void*) gravity_glDeleteTextures, 1, 1},
+    {"glDisableVertexAttribArray", (const void*) gravity_glDisableVertexAttribArray, 2, 0},
+    {"glDrawArrays", (const void*) gravity_glDrawArrays, 1, 1},
+    {"glDrawArraysInstanced", (const void*) gravity_glDrawArraysInstanced, 3, 1},
+    {"glEnable", (const void*) gravity_glEnable, 1, 0},
+    {"glEnableVertexAttribArray", (const void*) gravity_glEnableVertexAttribArray, 2, 0},
+    {"glEndQuery", (const void*) gravity_glEndQuery, 1, 5},
+    {"glFenceSync", (const void*) gravity_glFenceSync, 3, 2},
+    {"glFinish", (const void*) gravity_glFinish, 1, 0},
+    {"glFramebufferTexture2D", (const void*) gravity_glFramebufferTexture2D, 3, 0},
+    {"glGenBuffers", (const void*) gravity_glGenBuffers, 1, 5},
+    {"glGenFramebuffers", (const void*) gravity_glGenFramebuffers, 3, 0},
+    {"glGenQueries", (const void*) gravity_glGenQueries, 1, 5},
+    {"glGenTextures", (const void*) gravity_glGenTextures, 1, 1},
+    {"glGenerateMipmap", (const void*) gravity_glGenerateMipmap, 3, 0},
+    {"glGetAttribLocation", (const void*) gravity_glGetAttribLocation, 2, 0},
+    {"glGetError", (const void*) gravity_glGetError, 1, 0},
+    {"glGetFloatv", (const void*) gravity_glGetFloatv, 1, 0},
+    {"glGetIntegerv", (const void*) gravity_glGetIntegerv, 1, 0},
+    {"glGetProgramBinary", (const void*) gravity_glGetProgramBinary, 4, 1},
+    {"glGetProgramInfoLog", (const void*) gravity_glGetProgramInfoLog, 2, 0},
+    {"glGetProgramiv", (const void*) gravity_glGetProgramiv, 2, 0},
+    {"glGetQueryObjectiv", (const void*) gravity_glGetQueryObjectiv, 1, 5},
+    {"glGetQueryObjectui64v", (const void*) gravity_glGetQueryObjectui64v, 3, 3},
+    {"glGetShaderInfoLog", (const void*) gravity_glGetShaderInfoLog, 2, 0},
+    {"glGetShaderiv", (const void*) gravity_glGetShaderiv, 2, 0},
+    {"glGetString", (const void*) gravity_glGetString, 1, 0},
+    {"glGetStringi", (const void*) gravity_glGetStringi, 3, 0},
+    {"glGetTexLevelParameteriv", (const void*) gravity_glGetTexLevelParameteriv, 1, 0},
+    {"glGetUniformBlockIndex", (const void*) gravity_glGetUniformBlockIndex, 3, 1},
+    {"glGetUniformLocation", (const void*) gravity_glGetUniformLocation, 2, 0},
+    {"glLinkProgram", (const void*) gravity_glLinkProgram, 2, 0},
+    {"glMapBufferRange", (const void*) gravity_glMapBufferRange, 3, 0},
+    {"glPixelStorei", (const void*) gravity_glPixelStorei, 1, 0},
+    {"glProgramBinary", (const void*) gravity_glProgramBinary, 4, 1},
+    {"glProgramParameteri", (const void*) gravity_glProgramParameteri, 4, 1},
+    {"glReadPixels", (const void*) gravity_glReadPixels, 1, 0},
+    {"glShaderSource", (const void*) gravity_glShaderSource, 2, 0},
+    {"glTexImage2D", (const void*) gravity_glTexImage2D, 1, 0},
+    {"glTexParameteri", (const void*) gravity_glTexParameteri, 1, 0},
+    {"glUniform1i", (const void*) gravity_glUniform1i, 2, 0},
+    {"glUniformBlockBinding", (const void*) gravity_glUniformBlockBinding, 3, 1},
+    {"glUnmapBuffer", (const void*) gravity_glUnmapBuffer, 1, 5},
+    {"glUseProgram", (const void*) gravity_glUseProgram, 2, 0},
+    {"glVertexAttrib1f", (const void*) gravity_glVertexAttrib1f, 2, 0},
+    {"glVertexAttrib2f", (const void*) gravity_glVertexAttrib2f, 2, 0},
+    {"glVertexAttrib4f", (const void*) gravity_glVertexAttrib4f, 2, 0},
+    {"glVertexAttribDivisor", (const void*) gravity_glVertexAttribDivisor, 3, 3},
+    {"glVertexAttribPointer", (const void*) gravity_glVertexAttribPointer, 2, 0},
+    {"glViewport", (const void*) gravity_glViewport, 1, 0},
+  };
+
+  int major = 0, minor = 0;
+  const char *version = gravity_glGetString ? (const char*) glGetString(GL_VERSION) : nullptr;
+  if (version == nullptr || sscanf(version, "%d.%d", &major, &minor) != 2) {
+    error = "Could not get the OpenGL version.";
+    return false;
+  }
+
+  if (major < 3 || (major == 3 && minor < 3)) {
+    error = string("OpenGL 3.3 not found; the driver provides ") + version + ".";
+    return false;
+  }
+
+  // Required functions are reported all at once; any others only
+  // disable the version they belong to.
+  stringstream missing;
+  for (auto &f : functions) {
+    if (f.pointer == nullptr && f.major > 0 &&
+        (f.major < 3 || (f.major == 3 && f.minor <= 3)))
+      missing << " " << f.name;
+  }
+
+  if (!missing.str().empty()) {
+    error = "Missing OpenGL functions:" + missing.str() + ".";
+    return false;
+  }
+
+  auto hasVersion = [&](int vmajor, int vminor) {
+    if (major < vmajor || (major == vmajor && minor < vminor))
+      return false;
+
+    for (auto &f : functions) {
+      if (f.pointer == nullptr && f.major == vmajor && f.minor == vminor)
+        return false;
+    }
+
+    return true;
+  };
+
+  VERSION_4_1 = hasVersion(4, 1);
+  VERSION_4_3 = hasVersion(4, 3);
+
+  // Only the extensions the game checks for are looked up.
+  GLint count = 0;
+  glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+  for (GLint i = 0; i < count; ++i) {
+    const char *name = (const char*) glGetStringi(GL_EXTENSIONS, i);
+    if (strcmp(name, "GL_ARB_get_program_binary") == 0)
+      ARB_get_program_binary = true;
+    else if (strcmp(name, "GL_KHR_debug") == 0)
+      KHR_debug = true;
+  }
+
+  return true;
+}
+
+} // namespace GLLoader
@@ -0,0 +1,389 @@
+// Generated by gen-gl-loader.py from glcorearb.h; do not edit.
+
+#ifndef _GRAVITY_GL_LOADER_HH_
+#define _GRAVITY_GL_LOADER_HH_
+
+#if defined(__gl_h_) || defined(__GL_H__) || defined(__gl_glcorearb_h_) || defined(__gl_glext_h_)
+#error gl-loader.hh must be included before any other OpenGL header
+#endif
+
+// Keep the system OpenGL headers out so that only these declarations are seen.
+#define __gl_h_
+#define __GL_H__
+#define __gl_glcorearb_h_
+#define __gl_glext_h_
+#define __glext_h_
+
+#if defined(_WIN32) && !defined(APIENTRY) && !defined(__CYGWIN__)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN 1
+#endif
+#include <windows.h>
+#endif
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+#define APIENTRYP APIENTRY *
+#define GLAPIENTRY APIENTRY
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+typedef void GLvoid;
+typedef unsigned int GLenum;
+typedef float GLfloat;
+typedef int GLint;
+typedef int GLsizei;
+typedef unsigned int GLbitfield;
+typedef double GLdouble;
+typedef unsigned int GLuint;
+typedef unsigned char GLboolean;
+typedef uint8_t GLubyte;
+typedef float GLclampf;
+typedef double GLclampd;
+typedef ptrdiff_t GLsizeiptr;
+typedef intptr_t GLintptr;
+typedef char GLchar;
+typedef int16_t GLshort;
+typedef int8_t GLbyte;
+typedef uint16_t GLushort;
+typedef uint16_t GLhalf;
+typedef struct __GLsync *GLsync;
+typedef uint64_t GLuint64;
+typedef int64_t GLint64;
+typedef void (APIENTRY  *GLDEBUGPROC)(GLenum source,GLenum type,GLuint id,GLenum severity,GLsizei length,const GLchar *message,const void *userParam);
+
+#define GL_ARRAY_BUFFER 0x8892
+#define GL_BLEND 0x0BE2
+#define GL_CLAMP_TO_EDGE 0x812F
+#define GL_COLOR_ATTACHMENT0 0x8CE0
+#define GL_COLOR_BUFFER_BIT 0x00004000
+#define GL_COLOR_CLEAR_VALUE 0x0C22
+#define GL_COMPILE_STATUS 0x8B81
+#define GL_CONTEXT_FLAGS 0x821E
+#define GL_CONTEXT_FLAG_DEBUG_BIT 0x00000002
+#define GL_DEBUG_OUTPUT 0x92E0
+#define GL_DEBUG_OUTPUT_SYNCHRONOUS 0x8242
+#define GL_DEBUG_SEVERITY_HIGH 0x9146
+#define GL_DEBUG_SEVERITY_LOW 0x9148
+#define GL_DEBUG_SEVERITY_MEDIUM 0x9147
+#define GL_DEBUG_SEVERITY_NOTIFICATION 0x826B
+#define GL_DEBUG_SOURCE_API 0x8246
+#define GL_DEBUG_SOURCE_APPLICATION 0x824A
+#define GL_DEBUG_SOURCE_SHADER_COMPILER 0x8248
+#define GL_DEBUG_SOURCE_THIRD_PARTY 0x8249
+#define GL_DEBUG_SOURCE_WINDOW_SYSTEM 0x8247
+#define GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR 0x824D
+#define GL_DEBUG_TYPE_ERROR 0x824C
+#define GL_DEBUG_TYPE_PERFORMANCE 0x8250
+#define GL_DEBUG_TYPE_PORTABILITY 0x824F
+#define GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR 0x824E
+#define GL_DONT_CARE 0x1100
+#define GL_DRAW_FRAMEBUFFER 0x8CA9
+#define GL_DYNAMIC_DRAW 0x88E8
+#define GL_EXTENSIONS 0x1F03
+#define GL_FALSE 0
+#define GL_FLOAT 0x1406
+#define GL_FRAGMENT_SHADER 0x8B30
+#define GL_FRAMEBUFFER 0x8D40
+#define GL_FRAMEBUFFER_COMPLETE 0x8CD5
+#define GL_GEOMETRY_SHADER 0x8DD9
+#define GL_INFO_LOG_LENGTH 0x8B84
+#define GL_INVALID_INDEX 0xFFFFFFFFu
+#define GL_LINEAR 0x2601
+#define GL_LINEAR_MIPMAP_LINEAR 0x2703
+#define GL_LINK_STATUS 0x8B82
+#define GL_MAP_READ_BIT 0x0001
+#define GL_MAX_TEXTURE_SIZE 0x0D33
+#define GL_NO_ERROR 0
+#define GL_NUM_EXTENSIONS 0x821D
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#define GL_ONE_MINUS_SRC_ALPHA 0x0303
+#define GL_PIXEL_PACK_BUFFER 0x88EB
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define GL_QUERY_RESULT 0x8866
+#define GL_QUERY_RESULT_AVAILABLE 0x8867
+#define GL_R8 0x8229
+#define GL_READ_FRAMEBUFFER 0x8CA8
+#define GL_RED 0x1903
+#define GL_RENDERER 0x1F01
+#define GL_RGBA 0x1908
+#define GL_RGBA8 0x8058
+#define GL_SRC_ALPHA 0x0302
+#define GL_STATIC_DRAW 0x88E4
+#define GL_STREAM_DRAW 0x88E0
+#define GL_STREAM_READ 0x88E1
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#define GL_TEXTURE0 0x84C0
+#define GL_TEXTURE_2D 0x0DE1
+#define GL_TEXTURE_HEIGHT 0x1001
+#define GL_TEXTURE_MAG_FILTER 0x2800
+#define GL_TEXTURE_MAX_LEVEL 0x813D
+#define GL_TEXTURE_MIN_FILTER 0x2801
+#define GL_TEXTURE_WIDTH 0x1000
+#define GL_TEXTURE_WRAP_S 0x2802
+#define GL_TEXTURE_WRAP_T 0x2803
+#define GL_TIMEOUT_EXPIRED 0x911B
+#define GL_TIMEOUT_IGNORED 0xFFFFFFFFFFFFFFFFull
+#define GL_TIME_ELAPSED 0x88BF
+#define GL_TRIANGLES 0x0004
+#define GL_TRUE 1
+#define GL_UNIFORM_BUFFER 0x8A11
+#define GL_UNPACK_ALIGNMENT 0x0CF5
+#define GL_UNSIGNED_BYTE 0x1401
+#define GL_VENDOR 0x1F00
+#define GL_VERSION 0x1F02
+#define GL_VERTEX_SHADER 0x8B31
+
+typedef void (APIENTRYP PFNGLACTIVETEXTUREPROC) (GLenum texture);
+typedef void (APIENTRYP PFNGLATTACHSHADERPROC) (GLuint program, GLuint shader);
+typedef void (APIENTRYP PFNGLBEGINQUERYPROC) (GLenum target, GLuint id);
+typedef void (APIENTRYP PFNGLBINDBUFFERPROC) (GLenum target, GLuint buffer);
+typedef void (APIENTRYP PFNGLBINDBUFFERBASEPROC) (GLenum target, GLuint index, GLuint buffer);
+typedef void (APIENTRYP PFNGLBINDFRAMEBUFFERPROC) (GLenum target, GLuint framebuffer);
+typedef void (APIENTRYP PFNGLBINDTEXTUREPROC) (GLenum target, GLuint texture);
+typedef void (APIENTRYP PFNGLBLENDFUNCPROC) (GLenum sfactor, GLenum dfactor);
+typedef void (APIENTRYP PFNGLBLITFRAMEBUFFERPROC) (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter);
+typedef void (APIENTRYP PFNGLBUFFERDATAPROC) (GLenum target, GLsizeiptr size, const void *data, GLenum usage);
+typedef void (APIENTRYP PFNGLBUFFERSUBDATAPROC) (GLenum target, GLintptr offset, GLsizeiptr size, const void *data);
+typedef GLenum (APIENTRYP PFNGLCHECKFRAMEBUFFERSTATUSPROC) (GLenum target);
+typedef void (APIENTRYP PFNGLCLEARPROC) (GLbitfield mask);
+typedef void (APIENTRYP PFNGLCLEARCOLORPROC) (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+typedef GLenum (APIENTRYP PFNGLCLIENTWAITSYNCPROC) (GLsync sync, GLbitfield flags, GLuint64 timeout);
+typedef void (APIENTRYP PFNGLCOMPILESHADERPROC) (GLuint shader);
+typedef GLuint (APIENTRYP PFNGLCREATEPROGRAMPROC) (void);
+typedef GLuint (APIENTRYP PFNGLCREATESHADERPROC) (GLenum type);
+typedef void (APIENTRYP PFNGLDEBUGMESSAGECALLBACKPROC) (GLDEBUGPROC callback, const void *userParam);
+typedef void (APIENTRYP PFNGLDEBUGMESSAGECONTROLPROC) (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled);
+typedef void (APIENTRYP PFNGLDELETEBUFFERSPROC) (GLsizei n, const GLuint *buffers);
+typedef void (APIENTRYP PFNGLDELETEFRAMEBUFFERSPROC) (GLsizei n, const GLuint *framebuffers);
+typedef void (APIENTRYP PFNGLDELETEPROGRAMPROC) (GLuint program);
+typedef void (APIENTRYP PFNGLDELETEQUERIESPROC) (GLsizei n, const GLuint *ids);
+typedef void (APIENTRYP PFNGLDELETESHADERPROC) (GLuint shader);
+typedef void (APIENTRYP PFNGLDELETESYNCPROC) (GLsync sync);
+typedef void (APIENTRYP PFNGLDELETETEXTURESPROC) (GLsizei n, const GLuint *textures);
+typedef void (APIENTRYP PFNGLDISABLEVERTEXATTRIBARRAYPROC) (GLuint index);
+typedef void (APIENTRYP PFNGLDRAWARRAYSPROC) (GLenum mode, GLint first, GLsizei count);
+typedef void (APIENTRYP PFNGLDRAWARRAYSINSTANCEDPROC) (GLenum mode, GLint first, GLsizei count, GLsizei instancecount);
+typedef void (APIENTRYP PFNGLENABLEPROC) (GLenum cap);
+typedef void (APIENTRYP PFNGLENABLEVERTEXATTRIBARRAYPROC) (GLuint index);
+typedef void (APIENTRYP PFNGLENDQUERYPROC) (GLenum target);
+typedef GLsync (APIENTRYP PFNGLFENCESYNCPROC) (GLenum condition, GLbitfield flags);
+typedef void (APIENTRYP PFNGLFINISHPROC) (void);
+typedef void (APIENTRYP PFNGLFRAMEBUFFERTEXTURE2DPROC) (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+typedef void (APIENTRYP PFNGLGENBUFFERSPROC) (GLsizei n, GLuint *buffers);
+typedef void (APIENTRYP PFNGLGENFRAMEBUFFERSPROC) (GLsizei n, GLuint *framebuffers);
+typedef void (APIENTRYP PFNGLGENQUERIESPROC) (GLsizei n, GLuint *ids);
+typedef void (APIENTRYP PFNGLGENTEXTURESPROC) (GLsizei n, GLuint *textures);
+typedef void (APIENTRYP PFNGLGENERATEMIPMAPPROC) (GLenum target);
+typedef GLint (APIENTRYP PFNGLGETATTRIBLOCATIONPROC) (GLuint program, const GLchar *name);
+typedef GLenum (APIENTRYP PFNGLGETERRORPROC) (void);
+typedef void (APIENTRYP PFNGLGETFLOATVPROC) (GLenum pname, GLfloat *data);
+typedef void (APIENTRYP PFNGLGETINTEGERVPROC) (GLenum pname, GLint *data);
+typedef void (APIENTRYP PFNGLGETPROGRAMBINARYPROC) (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary);
+typedef void (APIENTRYP PFNGLGETPROGRAMINFOLOGPROC) (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
+typedef void (APIENTRYP PFNGLGETPROGRAMIVPROC) (GLuint program, GLenum pname, GLint *params);
+typedef void (APIENTRYP PFNGLGETQUERYOBJECTIVPROC) (GLuint id, GLenum pname, GLint *params);
+typedef void (APIENTRYP PFNGLGETQUERYOBJECTUI64VPROC) (GLuint id, GLenum pname, GLuint64 *params);
+typedef void (APIENTRYP PFNGLGETSHADERINFOLOGPROC) (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
+typedef void (APIENTRYP PFNGLGETSHADERIVPROC) (GLuint shader, GLenum pname, GLint *params);
+typedef const GLubyte * (APIENTRYP PFNGLGETSTRINGPROC) (GLenum name);
+typedef const GLubyte * (APIENTRYP PFNGLGETSTRINGIPROC) (GLenum name, GLuint index);
+typedef void (APIENTRYP PFNGLGETTEXLEVELPARAMETERIVPROC) (GLenum target, GLint level, GLenum pname, GLint *params);
+typedef GLuint (APIENTRYP PFNGLGETUNIFORMBLOCKINDEXPROC) (GLuint program, const GLchar *uniformBlockName);
+typedef GLint (APIENTRYP PFNGLGETUNIFORMLOCATIONPROC) (GLuint program, const GLchar *name);
+typedef void (APIENTRYP PFNGLLINKPROGRAMPROC) (GLuint program);
+typedef void * (APIENTRYP PFNGLMAPBUFFERRANGEPROC) (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+typedef void (APIENTRYP PFNGLPIXELSTOREIPROC) (GLenum pname, GLint param);
+typedef void (APIENTRYP PFNGLPROGRAMBINARYPROC) (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length);
+typedef void (APIENTRYP PFNGLPROGRAMPARAMETERIPROC) (GLuint program, GLenum pname, GLint value);
+typedef void (APIENTRYP PFNGLREADPIXELSPROC) (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels);
+typedef void (APIENTRYP PFNGLSHADERSOURCEPROC) (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length);
+typedef void (APIENTRYP PFNGLTEXIMAGE2DPROC) (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels);
+typedef void (APIENTRYP PFNGLTEXPARAMETERIPROC) (GLenum target, GLenum pname, GLint param);
+typedef void (APIENTRYP PFNGLUNIFORM1IPROC) (GLint location, GLint v0);
+typedef void (APIENTRYP PFNGLUNIFORMBLOCKBINDINGPROC) (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding);
+typedef GLboolean (APIENTRYP PFNGLUNMAPBUFFERPROC) (GLenum target);
+typedef void (APIENTRYP PFNGLUSEPROGRAMPROC) (GLuint program);
+typedef void (APIENTRYP PFNGLVERTEXATTRIB1FPROC) (GLuint index, GLfloat x);
+typedef void (APIENTRYP PFNGLVERTEXATTRIB2FPROC) (GLuint index, GLfloat x, GLfloat y);
+typedef void (APIENTRYP PFNGLVERTEXATTRIB4FPROC) (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
+typedef void (APIENTRYP PFNGLVERTEXATTRIBDIVISORPROC) (GLuint index, GLuint divisor);
+typedef void (APIENTRYP PFNGLVERTEXATTRIBPOINTERPROC) (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer);
+typedef void (APIENTRYP PFNGLVIEWPORTPROC) (GLint x, GLint y, GLsizei width, GLsizei height);
+
+extern PFNGLACTIVETEXTUREPROC gravity_glActiveTexture;
+#define glActiveTexture gravity_glActiveTexture
+extern PFNGLATTACHSHADERPROC gravity_glAttachShader;
+#define glAttachShader gravity_glAttachShader
+extern PFNGLBEGINQUERYPROC gravity_glBeginQuery;
+#define glBeginQuery gravity_glBeginQuery
+extern PFNGLBINDBUFFERPROC gravity_glBindBuffer;
+#define glBindBuffer gravity_glBindBuffer
+extern PFNGLBINDBUFFERBASEPROC gravity_glBindBufferBase;
+#define glBindBufferBase gravity_glBindBufferBase
+extern PFNGLBINDFRAMEBUFFERPROC gravity_glBindFramebuffer;
+#define glBindFramebuffer gravity_glBindFramebuffer
+extern PFNGLBINDTEXTUREPROC gravity_glBindTexture;
+#define glBindTexture gravity_glBindTexture
+extern PFNGLBLENDFUNCPROC gravity_glBlendFunc;
+#define glBlendFunc gravity_glBlendFunc
+extern PFNGLBLITFRAMEBUFFERPROC gravity_glBlitFramebuffer;
+#define glBlitFramebuffer gravity_glBlitFramebuffer
+extern PFNGLBUFFERDATAPROC gravity_glBufferData;
+#define glBufferData gravity_glBufferData
+extern PFNGLBUFFERSUBDATAPROC gravity_glBufferSubData;
+#define glBufferSubData gravity_glBufferSubData
+extern PFNGLCHECKFRAMEBUFFERSTATUSPROC gravity_glCheckFramebufferStatus;
+#define glCheckFramebufferStatus gravity_glCheckFramebufferStatus
+extern PFNGLCLEARPROC gravity_glClear;
+#define glClear gravity_glClear
+extern PFNGLCLEARCOLORPROC gravity_glClearColor;
+#define glClearColor gravity_glClearColor
+extern PFNGLCLIENTWAITSYNCPROC gravity_glClientWaitSync;
+#define glClientWaitSync gravity_glClientWaitSync
+extern PFNGLCOMPILESHADERPROC gravity_glCompileShader;
+#define glCompileShader gravity_glCompileShader
+extern PFNGLCREATEPROGRAMPROC gravity_glCreateProgram;
+#define glCreateProgram gravity_glCreateProgram
+extern PFNGLCREATESHADERPROC gravity_glCreateShader;
+#define glCreateShader gravity_glCreateShader
+extern PFNGLDEBUGMESSAGECALLBACKPROC gravity_glDebugMessageCallback;
+#define glDebugMessageCallback gravity_glDebugMessageCallback
+extern PFNGLDEBUGMESSAGECONTROLPROC gravity_glDebugMessageControl;
+#define glDebugMessageControl gravity_glDebugMessageControl
+extern PFNGLDELETEBUFFERSPROC gravity_glDeleteBuffers;
+#define glDeleteBuffers gravity_glDeleteBuffers
+extern PFNGLDELETEFRAMEBUFFERSPROC gravity_glDeleteFramebuffers;
+#define glDeleteFramebuffers gravity_glDeleteFramebuffers
+extern PFNGLDELETEPROGRAMPROC gravity_glDeleteProgram;
+#define glDeleteProgram gravity_glDeleteProgram
+extern PFNGLDELETEQUERIESPROC gravity_glDeleteQueries;
+#define glDeleteQueries gravity_glDeleteQueries
+extern PFNGLDELETESHADERPROC gravity_glDeleteShader;
+#define glDeleteShader gravity_glDeleteShader
+extern PFNGLDELETESYNCPROC gravity_glDeleteSync;
+#define glDeleteSync gravity_glDeleteSync
+extern PFNGLDELETETEXTURESPROC gravity_glDeleteTextures;
+#define glDeleteTextures gravity_glDeleteTextures
+extern PFNGLDISABLEVERTEXATTRIBARRAYPROC gravity_glDisableVertexAttribArray;
+#define glDisableVertexAttribArray gravity_glDisableVertexAttribArray
+extern PFNGLDRAWARRAYSPROC gravity_glDrawArrays;
+#define glDrawArrays gravity_glDrawArrays
+extern PFNGLDRAWARRAYSINSTANCEDPROC gravity_glDrawArraysInstanced;
+#define glDrawArraysInstanced gravity_glDrawArraysInstanced
+extern PFNGLENABLEPROC gravity_glEnable;
+#define glEnable gravity_glEnable
+extern PFNGLENABLEVERTEXATTRIBARRAYPROC gravity_glEnableVertexAttribArray;
+#define glEnableVertexAttribArray gravity_glEnableVertexAttribArray
+extern PFNGLENDQUERYPROC gravity_glEndQuery;
+#define glEndQuery gravity_glEndQuery
+extern PFNGLFENCESYNCPROC gravity_glFenceSync;
+#define glFenceSync gravity_glFenceSync
+extern PFNGLFINISHPROC gravity_glFinish;
+#define glFinish gravity_glFinish
+extern PFNGLFRAMEBUFFERTEXTURE2DPROC gravity_glFramebufferTexture2D;
+#define glFramebufferTexture2D gravity_glFramebufferTexture2D
+extern PFNGLGENBUFFERSPROC gravity_glGenBuffers;
+#define glGenBuffers gravity_glGenBuffers
+extern PFNGLGENFRAMEBUFFERSPROC gravity_glGenFramebuffers;
+#define glGenFramebuffers gravity_glGenFramebuffers
+extern PFNGLGENQUERIESPROC gravity_glGenQueries;
+#define glGenQueries gravity_glGenQueries
+extern PFNGLGENTEXTURESPROC gravity_glGenTextures;
+#define glGenTextures gravity_glGenTextures
+extern PFNGLGENERATEMIPMAPPROC gravity_glGenerateMipmap;
+#define glGenerateMipmap gravity_glGenerateMipmap
+extern PFNGLGETATTRIBLOCATIONPROC gravity_glGetAttribLocation;
+#define glGetAttribLocation gravity_glGetAttribLocation
+extern PFNGLGETERRORPROC gravity_glGetError;
+#define glGetError gravity_glGetError
+extern PFNGLGETFLOATVPROC gravity_glGetFloatv;
+#define glGetFloatv gravity_glGetFloatv
+extern PFNGLGETINTEGERVPROC gravity_glGetIntegerv;
+#define glGetIntegerv gravity_glGetIntegerv
+extern PFNGLGETPROGRAMBINARYPROC gravity_glGetProgramBinary;
+#define glGetProgramBinary gravity_glGetProgramBinary
+extern PFNGLGETPROGRAMINFOLOGPROC gravity_glGetProgramInfoLog;
+#define glGetProgramInfoLog gravity_glGetProgramInfoLog
+extern PFNGLGETPROGRAMIVPROC gravity_glGetProgramiv;
+#define glGetProgramiv gravity_glGetProgramiv
+extern PFNGLGETQUERYOBJECTIVPROC gravity_glGetQueryObjectiv;
+#define glGetQueryObjectiv gravity_glGetQueryObjectiv
+extern PFNGLGETQUERYOBJECTUI64VPROC gravity_glGetQueryObjectui64v;
+#define glGetQueryObjectui64v gravity_glGetQueryObjectui64v
+extern PFNGLGETSHADERINFOLOGPROC gravity_glGetShaderInfoLog;
+#define glGetShaderInfoLog gravity_glGetShaderInfoLog
+extern PFNGLGETSHADERIVPROC gravity_glGetShaderiv;
+#define glGetShaderiv gravity_glGetShaderiv
+extern PFNGLGETSTRINGPROC gravity_glGetString;
+#define glGetString gravity_glGetString
+extern PFNGLGETSTRINGIPROC gravity_glGetStringi;
+#define glGetStringi gravity_glGetStringi
+extern PFNGLGETTEXLEVELPARAMETERIVPROC gravity_glGetTexLevelParameteriv;
+#define glGetTexLevelParameteriv gravity_glGetTexLevelParameteriv
+extern PFNGLGETUNIFORMBLOCKINDEXPROC gravity_glGetUniformBlockIndex;
+#define glGetUniformBlockIndex gravity_glGetUniformBlockIndex
+extern PFNGLGETUNIFORMLOCATIONPROC gravity_glGetUniformLocation;
+#define glGetUniformLocation gravity_glGetUniformLocation
+extern PFNGLLINKPROGRAMPROC gravity_glLinkProgram;
+#define glLinkProgram gravity_glLinkProgram
+extern PFNGLMAPBUFFERRANGEPROC gravity_glMapBufferRange;
+#define glMapBufferRange gravity_glMapBufferRange
+extern PFNGLPIXELSTOREIPROC gravity_glPixelStorei;
+#define glPixelStorei gravity_glPixelStorei
+extern PFNGLPROGRAMBINARYPROC gravity_glProgramBinary;
+#define glProgramBinary gravity_glProgramBinary
+extern PFNGLPROGRAMPARAMETERIPROC gravity_glProgramParameteri;
+#define glProgramParameteri gravity_glProgramParameteri
+extern PFNGLREADPIXELSPROC gravity_glReadPixels;
+#define glReadPixels gravity_glReadPixels
+extern PFNGLSHADERSOURCEPROC gravity_glShaderSource;
+#define glShaderSource gravity_glShaderSource
+extern PFNGLTEXIMAGE2DPROC gravity_glTexImage2D;
+#define glTexImage2D gravity_glTexImage2D
+extern PFNGLTEXPARAMETERIPROC gravity_glTexParameteri;
+#define glTexParameteri gravity_glTexParameteri
+extern PFNGLUNIFORM1IPROC gravity_glUniform1i;
+#define glUniform1i gravity_glUniform1i
+extern PFNGLUNIFORMBLOCKBINDINGPROC gravity_glUniformBlockBinding;
+#define glUniformBlockBinding gravity_glUniformBlockBinding
+extern PFNGLUNMAPBUFFERPROC gravity_glUnmapBuffer;
+#define glUnmapBuffer gravity_glUnmapBuffer
+extern PFNGLUSEPROGRAMPROC gravity_glUseProgram;
+#define glUseProgram gravity_glUseProgram
+extern PFNGLVERTEXATTRIB1FPROC gravity_glVertexAttrib1f;
+#define glVertexAttrib1f gravity_glVertexAttrib1f
+extern PFNGLVERTEXATTRIB2FPROC gravity_glVertexAttrib2f;
+#define glVertexAttrib2f gravity_glVertexAttrib2f
+extern PFNGLVERTEXATTRIB4FPROC gravity_glVertexAttrib4f;
+#define glVertexAttrib4f gravity_glVertexAttrib4f
+extern PFNGLVERTEXATTRIBDIVISORPROC gravity_glVertexAttribDivisor;
+#define glVertexAttribDivisor gravity_glVertexAttribDivisor
+extern PFNGLVERTEXATTRIBPOINTERPROC gravity_glVertexAttribPointer;
+#define glVertexAttribPointer gravity_glVertexAttribPointer
+extern PFNGLVIEWPORTPROC gravity_glViewport;
+#define glViewport gravity_glViewport
+
+namespace GLLoader {
+
+/// Whether the context supports the given version, and provides the
+/// functions of that version the game uses.
+extern bool VERSION_4_1;
+extern bool VERSION_4_3;
+
+/// Whether the driver reports the given extension.
+extern bool ARB_get_program_binary;
+extern bool KHR_debug;
+
+/// Resolves the functions for the current context. Returns false, with
+/// a message listing what is missing, if the context is older than
+/// OpenGL 3.3 or lacks any of its functions.
+extern bool Init(std::string &error);
+
+} // namespace GLLoader
+
+#endif /* _GRAVITY_GL_LOADER_HH_ */
@@ -4,7 +4,6 @@
 #include <Box2D/Box2D.h>
 
 #include <iostream>
-#include <map>
 #include <fstream>
 #include <sstream>
 
@@ -35,39 +34,14 @@ void LoadString(string &str, istream &s) {
   s.read((char*) str.data(), size);
 }
 
-void SaveMap(const map<string, string> &m, ostream &s) {
-  size_t size = m.size();
-  WRITE(size, s);
-  for (auto &p : m) {
-    SaveString(p.first, s);
-    SaveString(p.second, s);
-  }
-}
-
-void LoadMap(map<string, string> &m, istream &s) {
-  string k, v;
-  size_t n;
-
-  m.clear();
-
-  READ(n, s);
-  for (int i = 0; i < n; ++i) {
-    LoadString(k, s);
-    LoadString(v, s);
-    m[k] = v;
-  }
-}
-
 void GetTextWidthP(string text, float32 hp, SDL_Window *window, float32 &wp) {
   int winw, winh;
   SDL_GetWindowSize(window, &winw, &winh);
 
-  int height_pixels = hp * winh;
-  TTF_Font *font = ResourceCache::GetFont(height_pixels);
+  float height_pixels = hp * winh;
+  const FontAtlas *font = ResourceCache::GetFontAtlas(FontId::KENVECTOR_FUTURE, height_pixels);
 
-  int w, h;
-  TTF_SizeText(font, text.data(), &w, &h);
-  wp = (float32) w / winw;
+  wp = font->GetTextWidth(text, height_pixels) / winw;
 }
 
 string ReadFile(const string &filename) {
@@ -90,32 +64,9 @@ string ReadFile(const string &filename) {
   return str;
 }
 
-void GetRelativeCoords(int x, int y,
-                       SDL_Window *window,
-                       TextAnchor xanchor, TextAnchor yanchor,
-                       float &xp, float &yp)
-{
-  int winw, winh;
-  SDL_GetWindowSize(window, &winw, &winh);
-
-  if (xanchor == TextAnchor::LEFT)
-    xp = (float) x / winw;
-  else if (xanchor == TextAnchor::RIGHT)
-    xp = (float) (winw - x) / winw;
-  else if (xanchor == TextAnchor::CENTER)
-    xp = (float) (x - winw / 2) / winw;
-
-  if (yanchor == TextAnchor::TOP)
-    yp = (float) y / winh;
-  else if (yanchor == TextAnchor::BOTTOM)
-    yp = (float) (winh - y) / winh;
-  else if (yanchor == TextAnchor::CENTER)
-    yp = (float) (winh / 2 - y) / winh;
-}
-
-void PlaySound(const string &name) {
+void PlaySound(SoundId id) {
   if (!mute) {
-    int ch = Mix_PlayChannel(-1, ResourceCache::GetSound(name), 0);
+    int ch = Mix_PlayChannel(-1, ResourceCache::GetSound(id), 0);
     if (ch == -1)
       cout << "Warning: Error playing sound. SDL_mixer error: "
            << Mix_GetError() << endl;
@@ -12,16 +12,16 @@
 HighScoresScreen::HighScoresScreen(SDL_Window *window) :
   Screen(window),
   currentScoreIndex(-1),
-  background(window, ResourceCache::GetTexture("background"))
+  background(window, ResourceCache::GetTexture(TextureId::BACKGROUND_DARK))
 {
   this->widgets.push_back(new ImageButtonWidget(this,
-                                                ResourceCache::GetTexture("main-menu"),
+                                                ResourceCache::GetTexture(TextureId::MAIN_MENU),
                                                 0.02, 0.02, 0.05,
                                                 TextAnchor::RIGHT, TextAnchor::BOTTOM,
                                                 {255, 0, 0, 200},
                                                 {255, 255, 255, 200}));
   this->widgets.push_back(new ImageWidget(this,
-                                          ResourceCache::GetTexture("high-scores"),
+                                          ResourceCache::GetTexture(TextureId::HIGH_SCORES),
                                           0.0, 0.1, 0.1,
                                           TextAnchor::CENTER, TextAnchor::TOP,
                                           {255, 0, 0, 255}));
@@ -44,11 +44,11 @@ HighScoresScreen::~HighScoresScreen() {
 
 }
 
-void HighScoresScreen::SwitchScreen(const map<string, string> &lastState) {
+void HighScoresScreen::SwitchScreen(const Transition &from) {
   this->currentScoreIndex = -1;
 
-  if (lastState.at("name") == "game-over") {
-    int score = std::stoi(lastState.at("score"));
+  if (from.type == TransitionType::GAME_OVER) {
+    int score = from.result.score;
     if (score != 0) {
       this->scores.push_back(score);
       std::sort(this->scores.begin(), this->scores.end(), std::greater<int>());
@@ -68,8 +68,23 @@ void HighScoresScreen::SwitchScreen(const map<string, string> &lastState) {
   for (auto w : this->widgets)
     w->Reset();
 
-  this->state.clear();
-  this->state["name"] = "highscores-ongoing";
+  this->UpdateLabels();
+}
+
+void HighScoresScreen::UpdateLabels() {
+  for (int i =0; i < this->scores.size(); ++i) {
+    SDL_Color c;
+    if (i == this->currentScoreIndex)
+      c = {255, 255, 0, 200};
+    else
+      c = {255, 255, 255, 200};
+    this->labels[i]->SetColor(c);
+    this->labels[i]->SetNumber(this->scores[i]);
+    this->labels[i]->SetVisible(true);
+  }
+
+  for (int i = this->scores.size(); i < 5; ++i)
+    this->labels[i]->SetVisible(false);
 }
 
 void HighScoresScreen::HandleEvent(const SDL_Event &e) {
@@ -80,24 +95,23 @@ void HighScoresScreen::HandleEvent(const SDL_Event &e) {
 void HighScoresScreen::HandleWidgetEvent(int event_type, Widget *widget) {
   switch (event_type) {
   case BUTTON_CLICK:
-    PlaySound("button-click");
+    PlaySound(SoundId::CLICK);
 
     if (widget == this->widgets[0]) { // Main Menu
-      this->state["name"] = "highscores-manu-selected";
+      this->Finish(TransitionType::BACK);
     }
 
     break;
 
   case BUTTON_MOUSE_ENTER:
-    PlaySound("mouse-over");
+    PlaySound(SoundId::HOVER);
     break;
   }
 }
 
 void HighScoresScreen::Reset() {
-  this->state.clear();
-  this->state["name"] = "highscores-ongoing";
   this->scores.clear();
+  this->UpdateLabels();
 }
 
 void HighScoresScreen::Save(ostream &s) const {
@@ -121,6 +135,8 @@ void HighScoresScreen::Load(istream &s) {
     s.read((char*) &score, sizeof(score));
     this->scores.push_back(score);
   }
+
+  this->UpdateLabels();
 }
 
 void HighScoresScreen::Advance(float dt) {
@@ -131,22 +147,7 @@ void HighScoresScreen::Advance(float dt) {
 void HighScoresScreen::Render(Renderer *renderer) {
   this->background.Draw();
 
-  for (int i =0; i < this->scores.size(); ++i) {
-    SDL_Color c;
-    if (i == this->currentScoreIndex)
-      c = {255, 255, 0, 200};
-    else
-      c = {255, 255, 255, 200};
-    this->labels[i]->SetColor(c);
-    this->labels[i]->SetNumber(this->scores[i]);
-    this->labels[i]->SetVisible(true);
-  }
-
-  for (int i = this->scores.size(); i < 5; ++i)
-    this->labels[i]->SetVisible(false);
-
-  for (auto w : this->widgets)
-    w->Render(renderer);
+  this->RenderWidgets(renderer);
 
   renderer->PresentScreen();
 }
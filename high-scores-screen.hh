@@ -12,11 +12,15 @@ protected:
 
   vector<NumberWidget*> labels;
 
+  // Shows the current scores; called whenever they change rather
+  // than on every frame.
+  void UpdateLabels();
+
 public:
   HighScoresScreen(SDL_Window *window);
   virtual ~HighScoresScreen();
 
-  virtual void SwitchScreen(const map<string, string> &lastState);
+  virtual void SwitchScreen(const Transition &from);
   virtual void HandleEvent(const SDL_Event &e);
   virtual void HandleWidgetEvent(int event_type, Widget *widget);
 
@@ -0,0 +1,486 @@
+#include "hud-layer.hh"
+#include "screen.hh"
+#include "resource-cache.hh"
+#include "gl-diagnostics.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+
+// Empty space left around each atlas entry so that linear filtering
+// never picks up pixels of the neighbouring entries.
+const int ATLAS_PADDING = 2;
+
+const int MIN_ATLAS_SIZE = 1024;
+
+HudAtlas *HudLayer::atlas = nullptr;
+
+HudAtlas::HudAtlas() :
+  texture(0),
+  size(0),
+  generation(0),
+  shelfX(0),
+  shelfY(0),
+  shelfHeight(0)
+{
+  glGenFramebuffers(1, &this->readFbo);
+  glGenFramebuffers(1, &this->drawFbo);
+}
+
+HudAtlas::~HudAtlas() {
+  glDeleteFramebuffers(1, &this->readFbo);
+  glDeleteFramebuffers(1, &this->drawFbo);
+  if (this->texture)
+    glDeleteTextures(1, &this->texture);
+}
+
+void HudAtlas::Reserve(int winw, int winh) {
+  GLint maxSize;
+  glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
+
+  // Nothing shown on the HUD is larger than the window, so an atlas
+  // as large as the window can hold at least the largest image.
+  int size = MIN_ATLAS_SIZE;
+  while (size < max(winw, winh) && size < maxSize)
+    size *= 2;
+  size = min(size, (int) maxSize);
+
+  if (size <= this->size)
+    return;
+
+  cout << "Creating " << size << "x" << size << " HUD atlas." << endl;
+
+  if (this->texture)
+    glDeleteTextures(1, &this->texture);
+
+  glGenTextures(1, &this->texture);
+  glBindTexture(GL_TEXTURE_2D, this->texture);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, size, size, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, this->drawFbo);
+  glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, this->texture, 0);
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+
+  this->size = size;
+  this->Clear();
+}
+
+void HudAtlas::Clear() {
+  GLfloat clearColor[4];
+  glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, this->drawFbo);
+  glClearColor(0.0, 0.0, 0.0, 0.0);
+  glClear(GL_COLOR_BUFFER_BIT);
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+
+  glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+  GL_CHECK("hud-atlas");
+
+  this->entries.clear();
+  this->shelfX = ATLAS_PADDING;
+  this->shelfY = ATLAS_PADDING;
+  this->shelfHeight = 0;
+  this->generation++;
+}
+
+void HudAtlas::Blit(GLuint source, const HudRect &rect) {
+  // Blit from the smallest mipmap level that is still at least as
+  // large as the destination, so that the linear filter does not skip
+  // over source pixels.
+  GLint level = 0, levelWidth, levelHeight;
+  glBindTexture(GL_TEXTURE_2D, source);
+  glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &levelWidth);
+  glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &levelHeight);
+  for (;;) {
+    GLint w, h;
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, level + 1, GL_TEXTURE_WIDTH, &w);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, level + 1, GL_TEXTURE_HEIGHT, &h);
+    if (w < rect.w || h < rect.h)
+      break;
+
+    level++;
+    levelWidth = w;
+    levelHeight = h;
+  }
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, this->readFbo);
+  glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, source, level);
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, this->drawFbo);
+
+  glBlitFramebuffer(0, 0, levelWidth, levelHeight,
+                    rect.x, rect.y, rect.x + rect.w, rect.y + rect.h,
+                    GL_COLOR_BUFFER_BIT, GL_LINEAR);
+  GL_CHECK("hud-atlas");
+
+  glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void HudAtlas::Forget(GLuint source) {
+  // The space is not reclaimed; only the next Clear does that.
+  for (auto it = this->entries.begin(); it != this->entries.end(); ) {
+    if (get<0>(it->first) == source)
+      it = this->entries.erase(it);
+    else
+      ++it;
+  }
+}
+
+bool HudAtlas::Get(GLuint source, int w, int h, HudRect &rect) {
+  auto key = make_tuple(source, w, h);
+  auto it = this->entries.find(key);
+  if (it != this->entries.end()) {
+    rect = it->second;
+    return true;
+  }
+
+  // Images that would not fit even in an empty atlas are shrunk.
+  int maxSize = this->size - 2 * ATLAS_PADDING;
+  if (w > maxSize || h > maxSize) {
+    float scale = min((float) maxSize / w, (float) maxSize / h);
+    w = max(1, (int) (w * scale));
+    h = max(1, (int) (h * scale));
+  }
+
+  if (this->shelfX + w + ATLAS_PADDING > this->size) {
+    this->shelfX = ATLAS_PADDING;
+    this->shelfY += this->shelfHeight + ATLAS_PADDING;
+    this->shelfHeight = 0;
+  }
+
+  if (this->shelfY + h + ATLAS_PADDING > this->size)
+    return false;
+
+  rect = {(float) this->shelfX, (float) this->shelfY, (float) w, (float) h};
+  this->shelfX += w + ATLAS_PADDING;
+  this->shelfHeight = max(this->shelfHeight, h);
+
+  this->Blit(source, rect);
+  this->entries[key] = rect;
+
+  return true;
+}
+
+void Widget::Invalidate() {
+  this->screen->hud.Invalidate();
+}
+
+HudLayer::HudLayer(SDL_Window *window) :
+  window(window),
+  dirty(true),
+  patched(false),
+  atlasFull(false),
+  atlasGeneration(-1),
+  fontGeneration(-1),
+  vboCapacity(0)
+{
+  if (!atlas)
+    atlas = new HudAtlas;
+
+  SDL_GetWindowSize(window, &this->width, &this->height);
+  glGenBuffers(1, &this->vbo);
+}
+
+HudLayer::~HudLayer() {
+  glDeleteBuffers(1, &this->vbo);
+}
+
+void HudLayer::ForgetTexture(GLuint texture) {
+  if (atlas)
+    atlas->Forget(texture);
+}
+
+size_t HudLayer::GetAtlasBytes() {
+  return atlas ? atlas->GetBytes() : 0;
+}
+
+void HudLayer::Invalidate() {
+  this->dirty = true;
+}
+
+HudRect HudLayer::Place(float x, float y, float width, float height, TextAnchor xanchor, TextAnchor yanchor) const {
+  HudRect rect;
+  rect.w = width * this->height;
+  rect.h = height * this->height;
+
+  if (xanchor == TextAnchor::LEFT)
+    rect.x = x * this->height;
+  else if (xanchor == TextAnchor::CENTER)
+    rect.x = (this->width - rect.w) / 2.0f + x * this->height;
+  else
+    rect.x = this->width - rect.w - x * this->height;
+
+  if (yanchor == TextAnchor::BOTTOM)
+    rect.y = y * this->height;
+  else if (yanchor == TextAnchor::CENTER)
+    rect.y = (this->height - rect.h) / 2.0f + y * this->height;
+  else
+    rect.y = this->height - rect.h - y * this->height;
+
+  return rect;
+}
+
+bool HudLayer::HitTest(const HudRect &rect, int x, int y) const {
+  // SDL's window coordinates have their origin at the top-left
+  // corner.
+  float fy = this->height - y;
+  return x >= rect.x && x <= rect.x + rect.w && fy >= rect.y && fy <= rect.y + rect.h;
+}
+
+void HudLayer::SetTexCoords(HudVertex *quad, const HudRect &entry,
+                            float u0, float v0, float u1, float v1) const
+{
+  float size = atlas->GetSize();
+  float s0 = (entry.x + u0 * entry.w) / size;
+  float s1 = (entry.x + u1 * entry.w) / size;
+
+  // The top row of the image comes first in the atlas.
+  float t0 = (entry.y + (1.0f - v0) * entry.h) / size;
+  float t1 = (entry.y + (1.0f - v1) * entry.h) / size;
+
+  const GLfloat texCoords[6][2] = {
+    // triangle 1
+    {s0, t0}, {s0, t1}, {s1, t0},
+
+    // triangle 2
+    {s0, t1}, {s1, t1}, {s1, t0},
+  };
+
+  for (int i = 0; i < 6; ++i) {
+    quad[i].tex_coord[0] = texCoords[i][0];
+    quad[i].tex_coord[1] = texCoords[i][1];
+  }
+}
+
+void HudLayer::UploadQuads(int first, int count) {
+  glBindBuffer(GL_ARRAY_BUFFER, this->vbo);
+  glBufferSubData(GL_ARRAY_BUFFER,
+                  first * 6 * sizeof(HudVertex),
+                  count * 6 * sizeof(HudVertex),
+                  &this->vertices[first * 6]);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+int HudLayer::AddImage(GLuint texture, const HudRect &rect,
+                       float u0, float v0, float u1, float v1,
+                       float r, float g, float b, float a)
+{
+  if (rect.w <= 0.0f || rect.h <= 0.0f)
+    return -1;
+
+  // The atlas holds the whole texture scaled so that the requested
+  // part of it ends up the size of the rectangle.
+  int w = ceil(rect.w / (u1 - u0));
+  int h = ceil(rect.h / (v1 - v0));
+
+  HudRect entry;
+  if (!atlas->Get(texture, w, h, entry)) {
+    this->atlasFull = true;
+    return -1;
+  }
+
+  float x0 = rect.x / this->width * 2.0f - 1.0f;
+  float y0 = rect.y / this->height * 2.0f - 1.0f;
+  float x1 = (rect.x + rect.w) / this->width * 2.0f - 1.0f;
+  float y1 = (rect.y + rect.h) / this->height * 2.0f - 1.0f;
+
+  HudVertex quad[] = {
+    // triangle 1
+    {{x0, y0}, {0.0f, 0.0f}, {r, g, b, a}},
+    {{x0, y1}, {0.0f, 0.0f}, {r, g, b, a}},
+    {{x1, y0}, {0.0f, 0.0f}, {r, g, b, a}},
+
+    // triangle 2
+    {{x0, y1}, {0.0f, 0.0f}, {r, g, b, a}},
+    {{x1, y1}, {0.0f, 0.0f}, {r, g, b, a}},
+    {{x1, y0}, {0.0f, 0.0f}, {r, g, b, a}},
+  };
+  this->SetTexCoords(quad, entry, u0, v0, u1, v1);
+
+  this->vertices.insert(this->vertices.end(), begin(quad), end(quad));
+  this->entries.push_back(entry);
+
+  return this->entries.size() - 1;
+}
+
+void HudLayer::SetImageRegion(int quad, float u0, float v0, float u1, float v1) {
+  // While a layout is pending the quads are about to be replaced
+  // anyway, and the new layout will use the new values.
+  if (this->dirty || quad < 0 || (size_t) quad >= this->entries.size())
+    return;
+
+  this->SetTexCoords(&this->vertices[quad * 6], this->entries[quad], u0, v0, u1, v1);
+  this->UploadQuads(quad, 1);
+  this->patched = true;
+}
+
+void HudLayer::SetImageColor(int first, int count, float r, float g, float b, float a) {
+  if (this->dirty || first < 0 || (size_t) (first + count) > this->entries.size())
+    return;
+
+  for (int i = first * 6; i < (first + count) * 6; ++i) {
+    this->vertices[i].color[0] = r;
+    this->vertices[i].color[1] = g;
+    this->vertices[i].color[2] = b;
+    this->vertices[i].color[3] = a;
+  }
+  this->UploadQuads(first, count);
+  this->patched = true;
+}
+
+void HudLayer::AddText(const FontAtlas *font, const string &text,
+                       float x, float y, float heightPixels,
+                       float r, float g, float b, float a)
+{
+  GLuint texture = font->GetTexture();
+  if (this->textRuns.empty() || this->textRuns.back().texture != texture)
+    this->textRuns.push_back({texture, this->textVertices.size(), 0});
+
+  float scale = heightPixels / font->GetPixelSize();
+
+  // Start on a pixel boundary, so that text drawn at the atlas size
+  // is not resampled.
+  float pen = round(x);
+  y = round(y);
+
+  for (auto c : text) {
+    const GlyphInfo &glyph = font->GetGlyph(c);
+
+    float x0 = pen / this->width * 2.0f - 1.0f;
+    float y0 = y / this->height * 2.0f - 1.0f;
+    float x1 = (pen + glyph.width * scale) / this->width * 2.0f - 1.0f;
+    float y1 = (y + glyph.height * scale) / this->height * 2.0f - 1.0f;
+
+    const HudVertex quad[] = {
+      // triangle 1
+      {{x0, y0}, {glyph.s0, glyph.t1}, {r, g, b, a}},
+      {{x0, y1}, {glyph.s0, glyph.t0}, {r, g, b, a}},
+      {{x1, y0}, {glyph.s1, glyph.t1}, {r, g, b, a}},
+
+      // triangle 2
+      {{x0, y1}, {glyph.s0, glyph.t0}, {r, g, b, a}},
+      {{x1, y1}, {glyph.s1, glyph.t0}, {r, g, b, a}},
+      {{x1, y0}, {glyph.s1, glyph.t1}, {r, g, b, a}},
+    };
+
+    this->textVertices.insert(this->textVertices.end(), begin(quad), end(quad));
+    this->textRuns.back().count += 6;
+
+    pen += glyph.advance * scale;
+  }
+}
+
+void HudLayer::Rebuild(const vector<Widget*> &widgets) {
+  atlas->Reserve(this->width, this->height);
+
+  // If the atlas runs out of space, start over with an empty one. The
+  // other screens will notice the new generation and lay themselves
+  // out again when they are shown.
+  for (int attempt = 0; attempt < 2; ++attempt) {
+    this->vertices.clear();
+    this->entries.clear();
+    this->textVertices.clear();
+    this->textRuns.clear();
+    this->atlasFull = false;
+
+    for (auto w : widgets)
+      w->Layout(this);
+
+    if (!this->atlasFull)
+      break;
+
+    cout << "HUD atlas full; clearing it." << endl;
+    atlas->Clear();
+  }
+
+  // Images and text share the vertex buffer, text last.
+  size_t count = this->vertices.size() + this->textVertices.size();
+  size_t textOffset = this->vertices.size() * sizeof(HudVertex);
+
+  glBindBuffer(GL_ARRAY_BUFFER, this->vbo);
+  if (count > this->vboCapacity) {
+    this->vboCapacity = count;
+    glBufferData(GL_ARRAY_BUFFER, this->vboCapacity * sizeof(HudVertex), nullptr, GL_DYNAMIC_DRAW);
+  }
+  if (!this->vertices.empty())
+    glBufferSubData(GL_ARRAY_BUFFER, 0, textOffset, this->vertices.data());
+  if (!this->textVertices.empty())
+    glBufferSubData(GL_ARRAY_BUFFER, textOffset, this->textVertices.size() * sizeof(HudVertex), this->textVertices.data());
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  this->atlasGeneration = atlas->GetGeneration();
+  this->fontGeneration = ResourceCache::GetFontGeneration();
+  this->dirty = false;
+}
+
+void HudLayer::Render(const vector<Widget*> &widgets) {
+  int winw, winh;
+  SDL_GetWindowSize(this->window, &winw, &winh);
+  if (winw != this->width || winh != this->height) {
+    this->width = winw;
+    this->height = winh;
+    this->dirty = true;
+  }
+
+  // Text runs refer to font atlases, which may have been evicted since
+  // the last layout.
+  if (this->dirty || this->atlasGeneration != atlas->GetGeneration() ||
+      this->fontGeneration != ResourceCache::GetFontGeneration())
+    this->Rebuild(widgets);
+
+  this->patched = false;
+
+  if (!this->vertices.empty())
+    this->Draw(ResourceCache::hudProgram, atlas->GetTexture(), 0, this->vertices.size());
+
+  for (auto &run : this->textRuns)
+    this->Draw(ResourceCache::textProgram, run.texture, this->vertices.size() + run.first, run.count);
+}
+
+bool HudLayer::NeedsRedraw() const {
+  return this->dirty || this->patched;
+}
+
+void HudLayer::Draw(GLuint program, GLuint texture, size_t first, size_t count) {
+  glUseProgram(program);
+
+  GLuint textureUniform = glGetUniformLocation(program, "texture0");
+
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, texture);
+  glUniform1i(textureUniform, 0); // set it to 0  because the texture is bound to GL_TEXTURE0
+
+  glBindBuffer(GL_ARRAY_BUFFER, this->vbo);
+
+  GLint coordAttr = glGetAttribLocation(program, "coord");
+  GLint texCoordAttr = glGetAttribLocation(program, "tex_coord");
+  GLint colorAttr = glGetAttribLocation(program, "color");
+
+  glEnableVertexAttribArray(coordAttr);
+  glEnableVertexAttribArray(texCoordAttr);
+  glEnableVertexAttribArray(colorAttr);
+
+  GLsizei stride = sizeof(HudVertex);
+  glVertexAttribPointer(coordAttr, 2, GL_FLOAT, GL_FALSE, stride, (void*) offsetof(HudVertex, coord));
+  glVertexAttribPointer(texCoordAttr, 2, GL_FLOAT, GL_FALSE, stride, (void*) offsetof(HudVertex, tex_coord));
+  glVertexAttribPointer(colorAttr, 4, GL_FLOAT, GL_FALSE, stride, (void*) offsetof(HudVertex, color));
+
+  glDrawArrays(GL_TRIANGLES, first, count);
+  GL_CHECK("hud-layer");
+
+  glDisableVertexAttribArray(coordAttr);
+  glDisableVertexAttribArray(texCoordAttr);
+  glDisableVertexAttribArray(colorAttr);
+
+  glBindTexture(GL_TEXTURE_2D, 0);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glUseProgram(0);
+}
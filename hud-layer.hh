@@ -0,0 +1,187 @@
+#ifndef _GRAVITY_HUD_LAYER_HH_
+#define _GRAVITY_HUD_LAYER_HH_
+
+#include "renderer.hh"
+#include "font-atlas.hh"
+
+#include <SDL2/SDL.h>
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+using namespace std;
+
+class Widget;
+
+/// A rectangle in window pixels, with the origin at the bottom-left
+/// corner of the window.
+struct HudRect {
+  float x;
+  float y;
+  float w;
+  float h;
+};
+
+struct HudVertex {
+  GLfloat coord[2];
+  GLfloat tex_coord[2];
+  GLfloat color[4];
+};
+
+/// A texture atlas shared by the HUD layers of all screens. It keeps
+/// copies of the images shown by widgets, already scaled down to the
+/// pixel size they are drawn at, so that all of them can be drawn
+/// from one texture.
+class HudAtlas {
+protected:
+  GLuint texture;
+  GLuint readFbo;
+  GLuint drawFbo;
+  int size;
+  int generation;
+
+  // Entries are packed into horizontal shelves, left to right and top
+  // to bottom.
+  int shelfX;
+  int shelfY;
+  int shelfHeight;
+
+  // Keyed by (source texture, width, height).
+  map<tuple<GLuint, int, int>, HudRect> entries;
+
+  void Blit(GLuint source, const HudRect &rect);
+
+public:
+  HudAtlas();
+  ~HudAtlas();
+
+  /// Makes sure the atlas is at least large enough for a window of
+  /// the given size. Growing the atlas clears it.
+  void Reserve(int winw, int winh);
+
+  /// Drops all entries.
+  void Clear();
+
+  /// Drops the entries copied from `source`, which is about to be
+  /// deleted. Texture names are reused, so a texture created later
+  /// could otherwise be shown with the old image.
+  void Forget(GLuint source);
+
+  /// Looks up the copy of `source` scaled to w x h pixels, adding it
+  /// if necessary. On return `rect` holds the area of the atlas
+  /// covered by the copy, top row first. Returns false if the atlas
+  /// is full.
+  bool Get(GLuint source, int w, int h, HudRect &rect);
+
+  GLuint GetTexture() const { return this->texture; }
+  int GetSize() const { return this->size; }
+
+  /// The video memory taken by the atlas texture.
+  size_t GetBytes() const { return (size_t) this->size * this->size * 4; }
+
+  /// Incremented whenever existing entries are invalidated.
+  int GetGeneration() const { return this->generation; }
+};
+
+/// Composites the widgets of a screen. The widgets are laid out into
+/// a single vertex buffer whenever the window size or one of the
+/// widgets changes; in between, drawing the HUD takes one draw call
+/// for the images and one for the text, no matter how many widgets
+/// there are.
+class HudLayer {
+protected:
+  SDL_Window *window;
+  int width;
+  int height;
+  bool dirty;
+  bool patched;
+  bool atlasFull;
+  int atlasGeneration;
+  int fontGeneration;
+  GLuint vbo;
+  size_t vboCapacity;
+  vector<HudVertex> vertices;
+
+  // The atlas entry of each image quad.
+  vector<HudRect> entries;
+
+  // Text is drawn after the images, from the glyph atlases, in runs
+  // of consecutive quads using the same atlas.
+  struct TextRun {
+    GLuint texture;
+    size_t first;
+    size_t count;
+  };
+
+  vector<HudVertex> textVertices;
+  vector<TextRun> textRuns;
+
+  static HudAtlas *atlas;
+
+  void Rebuild(const vector<Widget*> &widgets);
+  void Draw(GLuint program, GLuint texture, size_t first, size_t count);
+  void SetTexCoords(HudVertex *quad, const HudRect &entry,
+                    float u0, float v0, float u1, float v1) const;
+  void UploadQuads(int first, int count);
+
+public:
+  HudLayer(SDL_Window *window);
+  ~HudLayer();
+
+  /// Removes a texture that is about to be deleted from the shared
+  /// atlas.
+  static void ForgetTexture(GLuint texture);
+
+  /// The video memory taken by the shared atlas.
+  static size_t GetAtlasBytes();
+
+  /// Schedules a new layout before the next frame is drawn.
+  void Invalidate();
+
+  /// Returns the window rectangle of a widget positioned the way all
+  /// widgets are: x and y as a ratio of the window height from the
+  /// anchored edges, and width and height in units of the window
+  /// height.
+  HudRect Place(float x, float y, float width, float height, TextAnchor xanchor, TextAnchor yanchor) const;
+
+  /// Returns true if the point (x, y), in window coordinates as
+  /// reported by SDL mouse events, is inside `rect`.
+  bool HitTest(const HudRect &rect, int x, int y) const;
+
+  /// Adds a quad covering `rect` and showing the part (u0, v0)-(u1,
+  /// v1) of `texture`, tinted with the given color. Texture
+  /// coordinates have their origin at the bottom-left corner. Only
+  /// meant to be called by widgets while being laid out. Returns the
+  /// index of the new quad, or -1 if nothing was added. Quads added
+  /// one after the other have consecutive indices.
+  int AddImage(GLuint texture, const HudRect &rect,
+               float u0, float v0, float u1, float v1,
+               float r, float g, float b, float a);
+
+  /// Changes the part of the texture shown by a quad, in place. The
+  /// region must be the same size as the one the quad was added with.
+  /// Nothing needs to be laid out again; only the quad is uploaded.
+  void SetImageRegion(int quad, float u0, float v0, float u1, float v1);
+
+  /// Changes the color of `count` quads starting at `first`, in place.
+  void SetImageColor(int first, int count, float r, float g, float b, float a);
+
+  /// Adds the quads for a line of text, with the bottom-left corner of
+  /// the line at (x, y) in window pixels. Only meant to be called by
+  /// widgets while being laid out.
+  void AddText(const FontAtlas *font, const string &text,
+               float x, float y, float heightPixels,
+               float r, float g, float b, float a);
+
+  /// Draws the widgets, laying them out again first if necessary.
+  void Render(const vector<Widget*> &widgets);
+
+  /// Returns true if anything has changed since the last Render.
+  bool NeedsRedraw() const;
+
+  int GetWidth() const { return this->width; }
+  int GetHeight() const { return this->height; }
+};
+
+#endif /* _GRAVITY_HUD_LAYER_HH_ */
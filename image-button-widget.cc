@@ -1,6 +1,5 @@
 #include "image-button-widget.hh"
 #include "screen.hh"
-#include "helpers.hh"
 
 ImageButtonWidget::ImageButtonWidget(Screen *screen,
                                      GLuint texture,
@@ -26,9 +25,6 @@ ImageButtonWidget::ImageButtonWidget(Screen *screen,
 }
 
 void ImageButtonWidget::HandleEvent(const SDL_Event &e) {
-  int mousex, mousey;
-  float xp, yp;
-
   switch (e.type) {
   case SDL_MOUSEBUTTONDOWN:
     this->mouseDown = this->isActive;
@@ -43,33 +39,10 @@ void ImageButtonWidget::HandleEvent(const SDL_Event &e) {
     break;
 
   case SDL_MOUSEMOTION:
-    SDL_GetMouseState(&mousex, &mousey);
-    GetRelativeCoords(mousex, mousey, this->screen->window, this->xanchor, this->yanchor, xp, yp);
-
-    bool xInRange = false;
-    bool yInRange = false;
-
-    // this->width is expressed as a ratio of screen
-    // _height_. Calculate the width as a ratio of screen width for
-    // the following calculations.
-    int winw, winh;
-    SDL_GetWindowSize(this->screen->window, &winw, &winh);
-    float screenRatio = (float) winh / winw;
-    float w = this->width * screenRatio;
-    float nx = this->x * screenRatio;
-
-    if (this->xanchor == TextAnchor::CENTER)
-      xInRange = xp >= (nx - w / 2.0) && xp <= (nx + w / 2.0);
-    else
-      xInRange = xp >= nx && xp <= (nx + w);
-
-    if (this->yanchor == TextAnchor::CENTER)
-      yInRange = yp >= (this->y - this->height / 2.0) && yp <= (this->y + this->height / 2.0);
-    else
-      yInRange = yp >= this->y && yp <= (this->y + this->height);
-
+    // The rectangle is the one the widget was last drawn at, so there
+    // is nothing to recompute here.
     bool prevIsActive = this->isActive;
-    this->isActive = xInRange && yInRange;
+    this->isActive = this->screen->hud.HitTest(this->rect, e.motion.x, e.motion.y);
 
     if (this->isActive)
       this->SetColor(this->activeColorR, this->activeColorG, this->activeColorB, this->activeColorA);
@@ -91,10 +64,6 @@ void ImageButtonWidget::Advance(float dt) {
   this->ImageWidget::Advance(dt);
 }
 
-void ImageButtonWidget::Render(Renderer *renderer) {
-  this->ImageWidget::Render(renderer);
-}
-
 void ImageButtonWidget::Reset() {
   this->isActive = false;
   this->SetColor(this->inactiveColorR, this->inactiveColorG, this->inactiveColorB, this->inactiveColorA);
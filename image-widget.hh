@@ -14,7 +14,7 @@ protected:
   TextAnchor xanchor;
   TextAnchor yanchor;
   GLuint texture;
-  GLuint vbo;
+  HudRect rect;
   struct {
     float r;
     float g;
@@ -31,7 +31,7 @@ public:
 
   virtual void HandleEvent(const SDL_Event &e);
   virtual void Advance(float dt);
-  virtual void Render(Renderer *renderer);
+  virtual void Layout(HudLayer *hud);
   virtual void Reset();
 };
 
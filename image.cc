@@ -0,0 +1,340 @@
+#include "image.hh"
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// AVX2 kernels are compiled in whenever the compiler can target x86,
+// and only used if the CPU turns out to support them.
+#if defined(__SSE2__) && defined(__GNUC__)
+#include <immintrin.h>
+#define GRAVITY_IMAGE_AVX2
+#endif
+
+namespace {
+
+// Images are filtered in linear light, with color premultiplied by
+// alpha, as 14-bit values. The sum of four of them still fits in 16
+// bits, so the kernels never need to widen.
+const int LINEAR_BITS = 14;
+const int LINEAR_MAX = (1 << LINEAR_BITS) - 1;
+
+struct GammaTables {
+  uint16_t toLinear[256];
+  uint8_t toSrgb[LINEAR_MAX + 1];
+
+  GammaTables() {
+    for (int i = 0; i < 256; ++i) {
+      double c = i / 255.0;
+      double l = c <= 0.04045 ? c / 12.92 : pow((c + 0.055) / 1.055, 2.4);
+      this->toLinear[i] = (uint16_t) (l * LINEAR_MAX + 0.5);
+    }
+
+    for (int i = 0; i <= LINEAR_MAX; ++i) {
+      double l = (double) i / LINEAR_MAX;
+      double c = l <= 0.0031308 ? l * 12.92 : 1.055 * pow(l, 1 / 2.4) - 0.055;
+      this->toSrgb[i] = (uint8_t) (c * 255.0 + 0.5);
+    }
+  }
+};
+
+const GammaTables &GetGammaTables() {
+  static const GammaTables tables;
+  return tables;
+}
+
+// Converts 8-bit sRGB pixels to the working format. Straight alpha is
+// premultiplied, so that transparent pixels do not bleed their color
+// into smaller levels. Pixels premultiplied in sRGB are taken as they
+// are, which is close enough.
+vector<uint16_t> Decode(const uint8_t *pixels, int width, int height, bool premultiplied) {
+  const GammaTables &tables = GetGammaTables();
+  size_t count = (size_t) width * height;
+  vector<uint16_t> linear(count * 4);
+
+  for (size_t i = 0; i < count; ++i) {
+    const uint8_t *p = pixels + i * 4;
+    uint16_t *q = linear.data() + i * 4;
+    uint32_t a = p[3];
+
+    for (int c = 0; c < 3; ++c) {
+      uint32_t l = tables.toLinear[p[c]];
+      q[c] = premultiplied ? l : (l * a + 127) / 255;
+    }
+    q[3] = (a * LINEAR_MAX + 127) / 255;
+  }
+
+  return linear;
+}
+
+// Converts pixels in the working format back to 8-bit sRGB.
+void Encode(const uint16_t *linear, int width, int height, bool premultiplied, uint8_t *pixels) {
+  const GammaTables &tables = GetGammaTables();
+  size_t count = (size_t) width * height;
+
+  for (size_t i = 0; i < count; ++i) {
+    const uint16_t *q = linear + i * 4;
+    uint8_t *p = pixels + i * 4;
+    uint32_t a = q[3];
+
+    for (int c = 0; c < 3; ++c) {
+      uint32_t l = q[c];
+      if (!premultiplied)
+        l = a > 0 ? min<uint32_t>((l * LINEAR_MAX + a / 2) / a, LINEAR_MAX) : 0;
+      p[c] = tables.toSrgb[l];
+    }
+    p[3] = (a * 255 + LINEAR_MAX / 2) / LINEAR_MAX;
+  }
+}
+
+// Each kernel averages `count` 2x2 blocks of pixels from two source
+// rows into one destination row, and returns how many it did; the
+// rest are left to the scalar loop.
+typedef int (*HalveRowKernel)(const uint16_t *row0, const uint16_t *row1, uint16_t *dst, int count);
+
+int HalveRowScalar(const uint16_t *row0, const uint16_t *row1, uint16_t *dst, int count) {
+  for (int i = 0; i < count * 4; ++i) {
+    int x = (i / 4) * 8 + i % 4;
+    dst[i] = (row0[x] + row0[x + 4] + row1[x] + row1[x + 4] + 2) >> 2;
+  }
+
+  return count;
+}
+
+#if defined(__SSE2__)
+int HalveRowSse2(const uint16_t *row0, const uint16_t *row1, uint16_t *dst, int count) {
+  const __m128i two = _mm_set1_epi16(2);
+
+  int x = 0;
+  for (; x + 2 <= count; x += 2) {
+    const __m128i *a = (const __m128i*) (row0 + x * 8);
+    const __m128i *b = (const __m128i*) (row1 + x * 8);
+
+    // Vertical sums of source pixels 0-1 and 2-3, then the horizontal
+    // sum of each pair in the low half.
+    __m128i s0 = _mm_add_epi16(_mm_loadu_si128(a), _mm_loadu_si128(b));
+    __m128i s1 = _mm_add_epi16(_mm_loadu_si128(a + 1), _mm_loadu_si128(b + 1));
+    s0 = _mm_add_epi16(s0, _mm_srli_si128(s0, 8));
+    s1 = _mm_add_epi16(s1, _mm_srli_si128(s1, 8));
+
+    __m128i sum = _mm_unpacklo_epi64(s0, s1);
+    _mm_storeu_si128((__m128i*) (dst + x * 4), _mm_srli_epi16(_mm_add_epi16(sum, two), 2));
+  }
+
+  return x;
+}
+#endif
+
+#if defined(GRAVITY_IMAGE_AVX2)
+__attribute__((target("avx2")))
+int HalveRowAvx2(const uint16_t *row0, const uint16_t *row1, uint16_t *dst, int count) {
+  const __m256i two = _mm256_set1_epi16(2);
+
+  int x = 0;
+  for (; x + 4 <= count; x += 4) {
+    const __m256i *a = (const __m256i*) (row0 + x * 8);
+    const __m256i *b = (const __m256i*) (row1 + x * 8);
+
+    // Same as the SSE2 kernel, in both 128-bit lanes at once: each
+    // lane ends up with one destination pixel in its low half.
+    __m256i s0 = _mm256_add_epi16(_mm256_loadu_si256(a), _mm256_loadu_si256(b));
+    __m256i s1 = _mm256_add_epi16(_mm256_loadu_si256(a + 1), _mm256_loadu_si256(b + 1));
+    s0 = _mm256_add_epi16(s0, _mm256_srli_si256(s0, 8));
+    s1 = _mm256_add_epi16(s1, _mm256_srli_si256(s1, 8));
+
+    // Gives pixels 0, 2, 1, 3; put them back in order.
+    __m256i sum = _mm256_unpacklo_epi64(s0, s1);
+    sum = _mm256_permute4x64_epi64(sum, _MM_SHUFFLE(3, 1, 2, 0));
+    _mm256_storeu_si256((__m256i*) (dst + x * 4), _mm256_srli_epi16(_mm256_add_epi16(sum, two), 2));
+  }
+
+  return x;
+}
+#endif
+
+HalveRowKernel SelectHalveRowKernel() {
+#if defined(GRAVITY_IMAGE_AVX2)
+  if (__builtin_cpu_supports("avx2"))
+    return HalveRowAvx2;
+#endif
+
+#if defined(__SSE2__)
+  return HalveRowSse2;
+#else
+  return HalveRowScalar;
+#endif
+}
+
+// Scales an image in the working format down to half its size,
+// rounding down, with a 2x2 box filter. Sides of a single pixel are
+// averaged with themselves.
+void Halve(const uint16_t *src, int sw, int sh, uint16_t *dst, int dw, int dh) {
+  static const HalveRowKernel kernel = SelectHalveRowKernel();
+
+  for (int y = 0; y < dh; ++y) {
+    const uint16_t *row0 = src + (size_t) min(2 * y, sh - 1) * sw * 4;
+    const uint16_t *row1 = src + (size_t) min(2 * y + 1, sh - 1) * sw * 4;
+    uint16_t *out = dst + (size_t) y * dw * 4;
+
+    if (sw > 1) {
+      int done = kernel(row0, row1, out, dw);
+      HalveRowScalar(row0 + done * 8, row1 + done * 8, out + done * 4, dw - done);
+    }
+    else {
+      for (int c = 0; c < 4; ++c)
+        out[c] = (row0[c] + row1[c] + 1) >> 1;
+    }
+  }
+}
+
+uint8_t Scale(uint8_t value, float factor) {
+  float v = value * factor + 0.5f;
+  return v > 255.0f ? 255 : (uint8_t) v;
+}
+
+} // namespace
+
+namespace Images {
+
+void ApplyTransforms(TextureImage &image, const vector<TextureTransform> &transforms) {
+  const int channels = 4;
+  uint8_t *img = image.pixels;
+  int w = image.width, h = image.height;
+
+  for (auto &t : transforms) {
+    if (t.type == TextureTransform::PREMULTIPLY_ALPHA && channels < 4)
+      continue;
+
+    for (int i = 0; i < w * h; ++i) {
+      uint8_t *p = img + i * channels;
+
+      switch (t.type) {
+      case TextureTransform::BRIGHTNESS:
+        p[0] = Scale(p[0], t.factor);
+        p[1] = Scale(p[1], t.factor);
+        p[2] = Scale(p[2], t.factor);
+        break;
+
+      case TextureTransform::TINT:
+        p[0] = Scale(p[0], t.r);
+        p[1] = Scale(p[1], t.g);
+        p[2] = Scale(p[2], t.b);
+        break;
+
+      case TextureTransform::PREMULTIPLY_ALPHA:
+        p[0] = Scale(p[0], p[3] / 255.0f);
+        p[1] = Scale(p[1], p[3] / 255.0f);
+        p[2] = Scale(p[2], p[3] / 255.0f);
+        break;
+      }
+    }
+
+    if (t.type == TextureTransform::PREMULTIPLY_ALPHA)
+      image.premultiplied = true;
+  }
+}
+
+TextureImage Load(const string &filename, int maxSize) {
+  // Always decode to RGBA, which is what gets uploaded.
+  const int channels = 4;
+  int w, h, fileChannels;
+  uint8_t *img = stbi_load(filename.data(), &w, &h, &fileChannels, channels);
+  if (img == nullptr) {
+    stringstream ss;
+    ss << "Unable to load image. stb_image error: "
+       << stbi_failure_reason();
+    throw runtime_error(ss.str());
+  }
+
+  if (w <= maxSize && h <= maxSize)
+    return {w, h, 1, img, true, false};
+
+  // Halve the image as many times as needed, the same way mip levels
+  // are built.
+  vector<uint16_t> current = Decode(img, w, h, false), next;
+  stbi_image_free(img);
+
+  while (w > maxSize || h > maxSize) {
+    int nw = GetLevelSize(w, 1);
+    int nh = GetLevelSize(h, 1);
+    next.resize((size_t) nw * nh * 4);
+    Halve(current.data(), w, h, next.data(), nw, nh);
+    current.swap(next);
+    w = nw;
+    h = nh;
+  }
+
+  // Allocated the way stb_image allocates, so that both can be freed
+  // the same way.
+  img = (uint8_t*) malloc((size_t) w * h * channels);
+  Encode(current.data(), w, h, false, img);
+
+  return {w, h, 1, img, true, false};
+}
+
+int GetMipLevelCount(int width, int height) {
+  int levels = 1;
+  while (width > 1 || height > 1) {
+    width /= 2;
+    height /= 2;
+    levels++;
+  }
+
+  return levels;
+}
+
+size_t GetLevelOffset(int width, int height, int level) {
+  size_t offset = 0;
+  for (int i = 0; i < level; ++i)
+    offset += (size_t) GetLevelSize(width, i) * GetLevelSize(height, i) * 4;
+
+  return offset;
+}
+
+void BuildMipChain(TextureImage &image) {
+  int levels = GetMipLevelCount(image.width, image.height);
+  uint8_t *chain = (uint8_t*) malloc(GetLevelOffset(image.width, image.height, levels));
+  memcpy(chain, image.pixels, (size_t) image.width * image.height * 4);
+
+  // Each level is filtered from the previous one in the working
+  // format, and only rounded to 8-bit sRGB for storage, so that
+  // rounding errors do not add up down the chain.
+  vector<uint16_t> current = Decode(image.pixels, image.width, image.height, image.premultiplied), next;
+  for (int level = 1; level < levels; ++level) {
+    int sw = GetLevelSize(image.width, level - 1);
+    int sh = GetLevelSize(image.height, level - 1);
+    int dw = GetLevelSize(image.width, level);
+    int dh = GetLevelSize(image.height, level);
+
+    next.resize((size_t) dw * dh * 4);
+    Halve(current.data(), sw, sh, next.data(), dw, dh);
+    Encode(next.data(), dw, dh, image.premultiplied,
+           chain + GetLevelOffset(image.width, image.height, level));
+    current.swap(next);
+  }
+
+  Free(image);
+  image.levels = levels;
+  image.pixels = chain;
+  image.owned = true;
+}
+
+void Free(TextureImage &image) {
+  if (image.owned)
+    free(image.pixels);
+
+  image.pixels = nullptr;
+  image.owned = false;
+}
+
+} // namespace Images
@@ -0,0 +1,86 @@
+#ifndef _GRAVITY_IMAGE_HH_
+#define _GRAVITY_IMAGE_HH_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/// A pixel adjustment applied once to a texture image when it is
+/// loaded, instead of on every frame in a shader.
+struct TextureTransform {
+  enum Type {
+    BRIGHTNESS,       // multiply color by `factor`
+    TINT,             // multiply color channels by `r`, `g` and `b`
+    PREMULTIPLY_ALPHA // multiply color channels by alpha
+  };
+
+  Type type;
+  float factor;
+  float r, g, b;
+
+  static TextureTransform Brightness(float factor) {
+    return {BRIGHTNESS, factor, 1.0f, 1.0f, 1.0f};
+  }
+
+  static TextureTransform Tint(float r, float g, float b) {
+    return {TINT, 1.0f, r, g, b};
+  }
+
+  static TextureTransform PremultiplyAlpha() {
+    return {PREMULTIPLY_ALPHA, 1.0f, 1.0f, 1.0f, 1.0f};
+  }
+};
+
+/// An RGBA image with 8 bits per channel, top row first, ready to be
+/// uploaded as a texture. `pixels` holds `levels` mip levels one after
+/// the other, each half the size of the previous one.
+struct TextureImage {
+  int width;
+  int height;
+  int levels;
+  uint8_t *pixels;
+
+  // False if the pixels belong to someone else, e.g. a mapped pack
+  // file, and must not be freed.
+  bool owned;
+
+  // True once color has been multiplied by alpha.
+  bool premultiplied;
+};
+
+namespace Images {
+
+/// Decodes an image file into a single-level RGBA image, whatever the
+/// channels of the file, halving it until neither side is larger than
+/// `maxSize`. Throws a runtime_error on failure. Safe to call from any
+/// thread.
+extern TextureImage Load(const string &filename, int maxSize);
+
+extern void ApplyTransforms(TextureImage &image, const vector<TextureTransform> &transforms);
+
+/// Replaces a single-level image with its full mip chain, down to 1x1.
+/// Levels are averaged in linear light and weighted by alpha, using
+/// SSE2 or AVX2 when available.
+extern void BuildMipChain(TextureImage &image);
+
+/// Returns the number of levels in a full mip chain.
+extern int GetMipLevelCount(int width, int height);
+
+/// Returns the size of mip level `level` of an image `size` pixels
+/// wide (or high).
+inline int GetLevelSize(int size, int level) {
+  return size >> level > 0 ? size >> level : 1;
+}
+
+/// Returns the offset in bytes of mip level `level` in `pixels`.
+extern size_t GetLevelOffset(int width, int height, int level);
+
+/// Frees the pixels if they are owned.
+extern void Free(TextureImage &image);
+
+} // namespace Images
+
+#endif /* _GRAVITY_IMAGE_HH_ */
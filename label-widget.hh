@@ -2,6 +2,7 @@
 #define _GRAVITY_LABEL_WIDGET_HH_
 
 #include "widget.hh"
+#include "resource-ids.hh"
 
 #include <SDL2/SDL.h>
 
@@ -18,16 +19,11 @@ protected:
   TextAnchor xanchor;
   TextAnchor yanchor;
   SDL_Color color;
-
-  float width;
-
-  GLuint texture;
-  GLuint vbo;
-
-  void Rebuild();
+  FontId font;
+  HudRect rect;
 
 public:
-  LabelWidget(Screen *screen, const string &text, float x, float y, float height, TextAnchor xanchor, TextAnchor yanchor, const SDL_Color &color) :
+  LabelWidget(Screen *screen, const string &text, float x, float y, float height, TextAnchor xanchor, TextAnchor yanchor, const SDL_Color &color, FontId font=FontId::KENVECTOR_FUTURE) :
     Widget(screen),
     text(text),
     x(x),
@@ -36,13 +32,9 @@ public:
     xanchor(xanchor),
     yanchor(yanchor),
     color(color),
-    vbo(0),
-    texture(0)
-  {
-    this->Reset();
-  }
-
-  virtual ~LabelWidget();
+    font(font),
+    rect({0.0f, 0.0f, 0.0f, 0.0f})
+  {}
 
   void SetText(const string &text);
   const string &GetText() const;
@@ -51,7 +43,7 @@ public:
 
   virtual void HandleEvent(const SDL_Event &e);
   virtual void Advance(float dt);
-  virtual void Render(Renderer *renderer);
+  virtual void Layout(HudLayer *hud);
   virtual void Reset();
 };
 
@@ -7,34 +7,34 @@
 
 MainMenuScreen::MainMenuScreen(SDL_Window *window) :
   Screen(window),
-  background(window, ResourceCache::GetTexture("background"))
+  background(window, ResourceCache::GetTexture(TextureId::BACKGROUND_DARK))
 {
   this->widgets.push_back(new ImageButtonWidget(this,
-                                                ResourceCache::GetTexture("new-game"),
+                                                ResourceCache::GetTexture(TextureId::NEW_GAME),
                                                 0.1, 0.15, 0.08,
                                                 TextAnchor::RIGHT, TextAnchor::TOP,
                                                 {255, 0, 0, 128},
                                                 {255, 255, 255, 128}));
   this->widgets.push_back(new ImageButtonWidget(this,
-                                                ResourceCache::GetTexture("high-scores"),
+                                                ResourceCache::GetTexture(TextureId::HIGH_SCORES),
                                                 0.0, 0.3, 0.08,
                                                 TextAnchor::CENTER, TextAnchor::TOP,
                                                 {255, 0, 0, 128},
                                                 {255, 255, 255, 128}));
   this->widgets.push_back(new ImageButtonWidget(this,
-                                                ResourceCache::GetTexture("exit"),
+                                                ResourceCache::GetTexture(TextureId::EXIT),
                                                 0.1, 0.45, 0.08,
                                                 TextAnchor::LEFT, TextAnchor::TOP,
                                                 {255, 0, 0, 128},
                                                 {255, 255, 255, 128}));
   this->muteButton = new ImageButtonWidget(this,
-                                           ResourceCache::GetTexture("mute"),
+                                           ResourceCache::GetTexture(TextureId::MUTE),
                                            0.05, 0.05, 0.08,
                                            TextAnchor::LEFT, TextAnchor::BOTTOM,
                                            {255, 128, 128, 255},
                                            {255, 255, 255, 128});
   this->creditsButton = new ImageButtonWidget(this,
-                                              ResourceCache::GetTexture("credits-button"),
+                                              ResourceCache::GetTexture(TextureId::CREDITS_BUTTON),
                                               0.05, 0.15, 0.08,
                                               TextAnchor::LEFT, TextAnchor::BOTTOM,
                                               {255, 128, 128, 255},
@@ -43,7 +43,7 @@ MainMenuScreen::MainMenuScreen(SDL_Window *window) :
   this->widgets.push_back(this->muteButton);
   this->widgets.push_back(this->creditsButton);
   this->widgets.push_back(new ImageWidget(this,
-                                          ResourceCache::GetTexture("splash"),
+                                          ResourceCache::GetTexture(TextureId::SPLASH),
                                           -0.15, 0.0, 0.6,
                                           TextAnchor::RIGHT, TextAnchor::BOTTOM));
 
@@ -54,14 +54,11 @@ MainMenuScreen::~MainMenuScreen() {
 
 }
 
-void MainMenuScreen::SwitchScreen(const map<string, string> &lastState) {
-  this->state.clear();
-  this->state["name"] = "menu-ongoing";
-
+void MainMenuScreen::SwitchScreen(const Transition &from) {
   if (mute)
-    this->muteButton->SetTexture(ResourceCache::GetTexture("unmute"));
+    this->muteButton->SetTexture(ResourceCache::GetTexture(TextureId::UNMUTE));
   else
-    this->muteButton->SetTexture(ResourceCache::GetTexture("mute"));
+    this->muteButton->SetTexture(ResourceCache::GetTexture(TextureId::MUTE));
 
   for (auto w : this->widgets)
     w->Reset();
@@ -75,39 +72,38 @@ void MainMenuScreen::HandleEvent(const SDL_Event &e) {
 void MainMenuScreen::HandleWidgetEvent(int event_type, Widget *widget) {
   switch (event_type) {
   case BUTTON_CLICK:
-    PlaySound("button-click");
+    PlaySound(SoundId::CLICK);
 
     if (widget == this->widgets[0]) { // New Game
-      this->state["name"] = "menu-new-game-selected";
+      this->Finish(TransitionType::NEW_GAME);
     }
     if (widget == this->widgets[1]) { // High Scores
-      this->state["name"] = "menu-highscores-selected";
+      this->Finish(TransitionType::SHOW_HIGH_SCORES);
     }
     else if (widget == this->widgets[2]) { // Exit
-      this->state["name"] = "menu-exit-selected";
+      this->Finish(TransitionType::EXIT);
     }
     else if (widget == this->muteButton) { // Toggle Mute
       mute = !mute;
       if (mute)
-        this->muteButton->SetTexture(ResourceCache::GetTexture("unmute"));
+        this->muteButton->SetTexture(ResourceCache::GetTexture(TextureId::UNMUTE));
       else
-        this->muteButton->SetTexture(ResourceCache::GetTexture("mute"));
+        this->muteButton->SetTexture(ResourceCache::GetTexture(TextureId::MUTE));
     }
     else if (widget == this->creditsButton) { // Credits
-      this->state["name"] = "menu-credits-selected";
+      this->Finish(TransitionType::SHOW_CREDITS);
     }
 
     break;
 
   case BUTTON_MOUSE_ENTER:
-    PlaySound("mouse-over");
+    PlaySound(SoundId::HOVER);
     break;
   }
 }
 
 void MainMenuScreen::Reset() {
-  this->state.clear();
-  this->state["name"] = "menu-ongoing";
+
 }
 
 void MainMenuScreen::Save(ostream &s) const {
@@ -126,8 +122,7 @@ void MainMenuScreen::Advance(float dt) {
 void MainMenuScreen::Render(Renderer *renderer) {
   this->background.Draw();
 
-  for (auto w : this->widgets)
-    w->Render(renderer);
+  this->RenderWidgets(renderer);
 
   renderer->PresentScreen();
 }
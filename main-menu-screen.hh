@@ -14,7 +14,7 @@ public:
   MainMenuScreen(SDL_Window *window);
   virtual ~MainMenuScreen();
 
-  virtual void SwitchScreen(const map<string, string> &lastState);
+  virtual void SwitchScreen(const Transition &from);
   virtual void HandleEvent(const SDL_Event &e);
   virtual void HandleWidgetEvent(int event_type, Widget *widget);
 
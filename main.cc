@@ -1,29 +1,24 @@
 #include "renderer.hh"
-#include "credits-screen.hh"
-#include "splash-screen.hh"
-#include "game-screen.hh"
-#include "high-scores-screen.hh"
-#include "main-menu-screen.hh"
+#include "screen-manager.hh"
 #include "resource-cache.hh"
 #include "config.hh"
 #include "platform.hh"
-
-#define STB_IMAGE_WRITE_IMPLEMENTATION
-#include "stb_image_write.h"
+#include "frame-pacer.hh"
+#include "screenshot-writer.hh"
+#include "frame-recorder.hh"
+#include "startup-profile.hh"
 
 #include <SDL2/SDL.h>
 #include <unistd.h>
 #include <time.h>
 
 #include <iostream>
-#include <fstream>
 #include <sstream>
 
 using namespace std;
 
-void HandleEvents(SDL_Event &e, SDL_Window *window, bool &quit) {
+void HandleEvents(SDL_Event &e, SDL_Window *window, Renderer *renderer, bool &quit) {
   uint32_t flags;
-  int winw, winh;
 
   switch (e.type) {
   case SDL_QUIT:
@@ -47,30 +42,16 @@ void HandleEvents(SDL_Event &e, SDL_Window *window, bool &quit) {
       break;
 
     case SDLK_s:
-      SDL_GetWindowSize(window, &winw, &winh);
-      GLubyte *pixels = new GLubyte[4 * winw * winh];
-      glReadPixels(0, 0, winw, winh, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
-
-      // Flip the image so it will be the right way up in the image
-      // file.
-      auto rowsize = winw * 4;
-      GLubyte *tmprow = new GLubyte[rowsize];
-      for (int y = 0; y < winh / 2; y++) {
-        auto row1 = pixels + y * rowsize;
-        auto row2 = pixels + (winh-1-y) * rowsize;
-        memcpy(tmprow, row1, rowsize);
-        memcpy(row1, row2, rowsize);
-        memcpy(row2, tmprow, rowsize);
-      }
-      delete[] tmprow;
-
-      string filename = tmpnam(nullptr);
-      filename += ".png";
-      stbi_write_png(filename.data(), winw, winh, 4, pixels, 0);
-      cout << "Saved screenshot to " << filename << endl;
+      // The screenshot is read back and saved over the next few
+      // frames.
+      renderer->RequestScreenshot();
+      break;
 
-      delete[] pixels;
+#ifndef RELEASE_BUILD
+    case SDLK_m:
+      ResourceCache::PrintMemoryUsage();
       break;
+#endif
     }
     break;
 
@@ -79,32 +60,69 @@ void HandleEvents(SDL_Event &e, SDL_Window *window, bool &quit) {
       int winw, winh;
       SDL_GetWindowSize(window, &winw, &winh);
 
-      // Update OpenGL viewport.
-      glViewport(0, 0, winw, winh);
-
-      // Update window size in shader.
-      auto program = ResourceCache::texturedPolygonProgram;
-      glUseProgram(program);
-      GLuint resolutionUniform = glGetUniformLocation(program, "resolution");
-      glUniform2f(resolutionUniform, winw, winh);
-      glUseProgram(0);
-
-      program = ResourceCache::hudTexturedPolygonProgram;
-      glUseProgram(program);
-      resolutionUniform = glGetUniformLocation(program, "resolution");
-      glUniform2f(resolutionUniform, winw, winh);
-      glUseProgram(0);
+      // Update OpenGL viewport and the resolution seen by shaders.
+      renderer->SetViewport(winw, winh);
     }
     break;
   } // switch (e.type)
 }
 
+// Passes an event to the current screen as well as to the global
+// handler.
+void DispatchEvent(SDL_Event &e, Screen *screen, SDL_Window *window, Renderer *renderer, bool &quit) {
+  screen->HandleEvent(e);
+  HandleEvents(e, window, renderer, quit);
+
+  // Anything but mouse motion may change what the screen shows. Mouse
+  // motion only matters when it changes the HUD, which the screen
+  // notices by itself.
+  if (e.type != SDL_MOUSEMOTION)
+    screen->RequestRedraw();
+}
+
 int main_body(int argc, char *argv[]) {
   bool quit = false;
   SDL_Window *window = nullptr;
 
-  if (argc > 1)
-    ResourceCache::RESOURCES_PATH = argv[1];
+  // Parse the command line: options, and optionally the path to the
+  // resources directory.
+  float timeScale = 0.0;
+  string recordTarget;
+  string screenshotDirectory = GetUserHomeDirectory() + "/" + Config::ScreenshotDirectory;
+  bool startupReport = false;
+  bool startupReportJson = false;
+  for (int i = 1; i < argc; ++i) {
+    string arg = argv[i];
+    if (arg == "--time-scale" && i + 1 < argc) {
+      timeScale = atof(argv[++i]);
+    }
+    else if (arg == "--record" && i + 1 < argc) {
+      recordTarget = argv[++i];
+    }
+    else if (arg == "--screenshot-dir" && i + 1 < argc) {
+      screenshotDirectory = argv[++i];
+    }
+    else if (arg == "--startup-report") {
+      startupReport = true;
+    }
+    else if (arg == "--startup-report-json") {
+      startupReport = true;
+      startupReportJson = true;
+    }
+    else if (arg.compare(0, 2, "--") == 0) {
+      SHOW_MSG("Unknown or incomplete option: " << arg);
+      return 1;
+    }
+    else
+      ResourceCache::RESOURCES_PATH = arg;
+  }
+
+  // The JSON report is meant to be piped into other tools, so
+  // everything else the game logs goes to stderr and stdout only gets
+  // the report.
+  streambuf *reportBuffer = cout.rdbuf();
+  if (startupReportJson)
+    cout.rdbuf(cerr.rdbuf());
 
   // Seed the pseudo-random number generator with time.
   srand(time(0));
@@ -114,6 +132,7 @@ int main_body(int argc, char *argv[]) {
     SHOW_MSG("SDL could not be initialized! SDL_Error: " << SDL_GetError());
     return 1;
   }
+  StartupProfile::Mark("sdl-init");
 
   // Create window.
   window = SDL_CreateWindow("gravity",
@@ -126,131 +145,121 @@ int main_body(int argc, char *argv[]) {
     SHOW_MSG("Window could not be created. SDL_Error: " << SDL_GetError());
     return 2;
   }
+  StartupProfile::Mark("window");
 
   Renderer *renderer = new Renderer(window);
+
+  // Record every frame, starting with the splash screen.
+  FrameRecorder *recorder = nullptr;
+  if (!recordTarget.empty()) {
+    recorder = new FrameRecorder(recordTarget, Config::RecordingFrameRate);
+    renderer->SetRecorder(recorder);
+  }
+
   ResourceCache::Init();
 
-  Screen *splashScreen = new SplashScreen(window);
-  SDL_ShowWindow(window);
+  string savefile = GetUserHomeDirectory() + "/.gravity.save";
+
+  // Only the splash screen exists at first. The others are created
+  // once the splash screen has loaded everything they need.
+  ScreenManager *screens = new ScreenManager(window, savefile);
+  if (timeScale > 0.0)
+    screens->SetTimeScale(timeScale);
 
-  // Set resolution uniforms in shader programs that need it.
-  int winw, winh;
-  SDL_GetWindowSize(window, &winw, &winh);
-  auto program = ResourceCache::texturedPolygonProgram;
-  glUseProgram(program);
-  GLuint resolutionUniform = glGetUniformLocation(program, "resolution");
-  glUniform2f(resolutionUniform, winw, winh);
-  glUseProgram(0);
-
-  program = ResourceCache::hudTexturedPolygonProgram;
-  glUseProgram(program);
-  resolutionUniform = glGetUniformLocation(program, "resolution");
-  glUniform2f(resolutionUniform, winw, winh);
-  glUseProgram(0);
+  SDL_ShowWindow(window);
+  StartupProfile::Mark("splash-screen");
 
   // On some systems (like on StumpWM), a size change might happen
   // right after the window is shown. This takes care of that.
   SDL_Event e;
   while (SDL_PollEvent(&e))
-    HandleEvents(e, window, quit);
-
-  splashScreen->Render(renderer);
-
-  Screen *mainMenuScreen = new MainMenuScreen(window);
-  splashScreen->Render(renderer);
-
-  Screen *gameScreen = new GameScreen(window);
-  splashScreen->Render(renderer);
-
-  Screen *highScoresScreen = new HighScoresScreen(window);
-  splashScreen->Render(renderer);
-
-  Screen *creditsScreen = new CreditsScreen(window);
-  splashScreen->Render(renderer);
+    HandleEvents(e, window, renderer, quit);
 
 #ifdef RELEASE_BUILD
   SDL_SetWindowFullscreen(window, SDL_WINDOW_FULLSCREEN_DESKTOP);
 #endif
 
-  string savefile = GetUserHomeDirectory() + "/.gravity.save";
+  ScreenshotWriter screenshots(screenshotDirectory);
 
-  ifstream input(savefile, ifstream::in | ifstream::binary);
-  if (input) {
-    highScoresScreen->Load(input);
-  }
+  // While recording, the game runs at the frame rate of the recording
+  // and every frame is drawn, so that the video plays at the right
+  // speed.
+  FramePacer pacer(recorder ? Config::RecordingFrameRate : Config::FrameRate);
+  if (Config::VSync)
+    pacer.SetSwapInterval(Config::AdaptiveVSync ? -1 : 1);
   else
-    cout << "No save file." << endl;
-  input.close();
-
-  Screen *currentScreen = splashScreen;
+    pacer.SetSwapInterval(0);
 
-  uint32_t lastTime = SDL_GetTicks();
+  // With --startup-report, the first frame of the splash screen and of
+  // the main menu are timed, and the game exits after the latter.
+  bool firstFrame = true;
 
   while (!quit) {
+    Screen *currentScreen = screens->GetCurrent();
+    bool hidden = SDL_GetWindowFlags(window) & (SDL_WINDOW_HIDDEN | SDL_WINDOW_MINIMIZED);
+
+    if (recorder)
+      currentScreen->RequestRedraw();
+
+    // When nothing is moving and nothing has changed, there is
+    // nothing to do until an event arrives. The same goes for a hidden
+    // window, which is not drawn at all. Screenshots being read back
+    // still need to be collected, though.
     SDL_Event e;
-    while (SDL_PollEvent(&e)) {
-      currentScreen->HandleEvent(e);
-      HandleEvents(e, window, quit);
-    } // while (SDL_PollEvent(&e))
-
-    int dt = SDL_GetTicks() - lastTime;
-    SDL_Delay(Config::TimeStep > dt ? Config::TimeStep - dt : 0);
-    dt = SDL_GetTicks() - lastTime;
-    lastTime = SDL_GetTicks();
-    currentScreen->Advance(dt / 1000.0);
-    currentScreen->Render(renderer);
-
-    if (currentScreen->state["name"] == "splash-over") {
-      mainMenuScreen->SwitchScreen(currentScreen->state);
-      currentScreen = mainMenuScreen;
-    }
-    else if (currentScreen->state["name"] == "game-over") {
-      highScoresScreen->SwitchScreen(currentScreen->state);
-      currentScreen = highScoresScreen;
-    }
-    else if (currentScreen->state["name"] == "menu-new-game-selected") {
-      gameScreen->Reset();
-      gameScreen->SwitchScreen(currentScreen->state);
-      currentScreen = gameScreen;
+    if (!currentScreen->IsAnimating() && !renderer->IsScreenshotPending() &&
+        (hidden || !currentScreen->NeedsRedraw())) {
+      // Use the idle time to get the next screen ready.
+      screens->Prefetch();
+
+      if (SDL_WaitEventTimeout(&e, Config::IdleTimeout))
+        DispatchEvent(e, currentScreen, window, renderer, quit);
+
+      // Do not count the time spent waiting as elapsed.
+      pacer.Reset();
     }
-    else if (currentScreen->state["name"] == "menu-highscores-selected") {
-      highScoresScreen->SwitchScreen(currentScreen->state);
-      currentScreen = highScoresScreen;
+
+    while (SDL_PollEvent(&e))
+      DispatchEvent(e, currentScreen, window, renderer, quit);
+
+    currentScreen->Advance(pacer.Wait());
+
+    if (!hidden && currentScreen->NeedsRedraw()) {
+      currentScreen->Render(renderer);
+      currentScreen->RedrawDone();
+
+      if (startupReport && firstFrame) {
+        // Wait for the frame to actually be drawn, so that it is
+        // counted in full.
+        glFinish();
+        firstFrame = false;
+
+        if (screens->GetCurrentId() == ScreenId::SPLASH)
+          StartupProfile::Mark("splash-first-frame");
+        else {
+          StartupProfile::Mark("first-frame");
+          ostream report(reportBuffer);
+          StartupProfile::Report(report, startupReportJson);
+          break;
+        }
+      }
     }
-    else if (currentScreen->state["name"] == "menu-exit-selected") {
-      SDL_Event quitEvent;
-      quitEvent.type = SDL_QUIT;
-      SDL_PushEvent(&quitEvent);
+
+    PixelImage screenshot;
+    while (renderer->TakeScreenshot(screenshot))
+      screenshots.Save(move(screenshot));
+
+    if (!screens->Update())
       break;
-    }
-    else if (currentScreen->state["name"] == "menu-credits-selected") {
-      creditsScreen->SwitchScreen(currentScreen->state);
-      currentScreen = creditsScreen;
-    }
-    else if (currentScreen->state["name"] == "highscores-manu-selected") {
-      mainMenuScreen->SwitchScreen(currentScreen->state);
-      currentScreen = mainMenuScreen;
-    }
-    else if (currentScreen->state["name"] == "credits-manu-selected") {
-      mainMenuScreen->SwitchScreen(currentScreen->state);
-      currentScreen = mainMenuScreen;
-    }
-  } // while (!quit)
 
-  ofstream output(savefile, ofstream::out | ofstream::binary);
-  if (output) {
-    highScoresScreen->Save(output);
-  }
-  else {
-#ifndef RELEASE_BUILD
-    cout << "Could not write to save file." << endl;
-#endif
-  }
+    if (screens->GetCurrent() != currentScreen)
+      firstFrame = true;
+  } // while (!quit)
 
-  delete mainMenuScreen;
-  delete highScoresScreen;
-  delete gameScreen;
+  // Saves the high scores, if they were ever loaded.
+  delete screens;
 
+  renderer->SetRecorder(nullptr);
+  delete recorder;
   delete renderer;
 
   // Destroy the window.
@@ -259,6 +268,8 @@ int main_body(int argc, char *argv[]) {
   // Quit SDL.
   SDL_Quit();
 
+  cout.rdbuf(reportBuffer);
+
   return 0;
 }
 
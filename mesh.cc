@@ -1,7 +1,9 @@
 #include "mesh.hh"
 #include "resource-cache.hh"
+#include "gl-diagnostics.hh"
 
 #include <iostream>
+#include <cstddef>
 
 Mesh::Mesh(const GLfloat *vertexData, int n, GLuint texture) :
   vertexCount(n),
@@ -13,10 +15,13 @@ Mesh::Mesh(const GLfloat *vertexData, int n, GLuint texture) :
   glBindBuffer(GL_ARRAY_BUFFER, this->vbo);
   glBufferData(GL_ARRAY_BUFFER, n * 4 * sizeof(GLfloat), vertexData, GL_STATIC_DRAW);
   glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  ResourceCache::RetainTexture(this->texture);
 }
 
 Mesh::~Mesh() {
   glDeleteBuffers(1, &this->vbo);
+  ResourceCache::ReleaseTexture(this->texture);
 }
 
 void Mesh::SetColor(float r, float g, float b, float a) {
@@ -56,8 +61,7 @@ void Mesh::Draw(const b2Vec2 &pos, float32 angle, float32 scale_factor) const {
   glVertexAttrib4f(colorAttr, this->color.r, this->color.g, this->color.b, this->color.a);
 
   glDrawArrays(GL_TRIANGLES, 0, this->vertexCount);
-  if (glGetError() != GL_NO_ERROR)
-    cout << "mesh: OpenGL draw error." << endl;
+  GL_CHECK("mesh");
 
   glDisableVertexAttribArray(coordAttr);
   glDisableVertexAttribArray(texCoordAttr);
@@ -66,3 +70,133 @@ void Mesh::Draw(const b2Vec2 &pos, float32 angle, float32 scale_factor) const {
   glBindBuffer(GL_ARRAY_BUFFER, 0);
   glUseProgram(0);
 }
+
+void Mesh::DrawInstanced(GLuint instanceBuffer, int first, int count) const {
+  GLuint program = ResourceCache::texturedPolygonProgram;
+  glUseProgram(program);
+
+  GLuint textureUniform = glGetUniformLocation(program, "texture0");
+
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, this->texture);
+  glUniform1i(textureUniform, 0); // set it to 0  because the texture is bound to GL_TEXTURE0
+
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+  GLint coordAttr = glGetAttribLocation(program, "coord");
+  GLint texCoordAttr = glGetAttribLocation(program, "tex_coord");
+  GLint positionAttr = glGetAttribLocation(program, "position");
+  GLint angleAttr = glGetAttribLocation(program, "angle");
+  GLint scaleAttr = glGetAttribLocation(program, "scale_factor");
+  GLint colorAttr = glGetAttribLocation(program, "color");
+
+  // Per-vertex attributes come from the mesh itself.
+  glBindBuffer(GL_ARRAY_BUFFER, this->vbo);
+
+  glEnableVertexAttribArray(coordAttr);
+  glEnableVertexAttribArray(texCoordAttr);
+
+  glVertexAttribPointer(coordAttr, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(GLfloat), (void*) 0);
+  glVertexAttribPointer(texCoordAttr, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(GLfloat), (void*) (2 * sizeof(GLfloat)));
+
+  // Per-instance attributes come from the instance buffer and advance
+  // once per instance.
+  glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+
+  const GLint instanceAttrs[] = {positionAttr, angleAttr, scaleAttr, colorAttr};
+  for (auto attr : instanceAttrs) {
+    glEnableVertexAttribArray(attr);
+    glVertexAttribDivisor(attr, 1);
+  }
+
+  size_t base = first * sizeof(MeshInstance);
+  GLsizei stride = sizeof(MeshInstance);
+  glVertexAttribPointer(positionAttr, 2, GL_FLOAT, GL_FALSE, stride, (void*) (base + offsetof(MeshInstance, position)));
+  glVertexAttribPointer(angleAttr, 1, GL_FLOAT, GL_FALSE, stride, (void*) (base + offsetof(MeshInstance, angle)));
+  glVertexAttribPointer(scaleAttr, 1, GL_FLOAT, GL_FALSE, stride, (void*) (base + offsetof(MeshInstance, scale_factor)));
+  glVertexAttribPointer(colorAttr, 4, GL_FLOAT, GL_FALSE, stride, (void*) (base + offsetof(MeshInstance, color)));
+
+  glDrawArraysInstanced(GL_TRIANGLES, 0, this->vertexCount, count);
+  GL_CHECK("mesh");
+
+  // Restore the state expected by Draw, which sets these attributes
+  // as constants.
+  for (auto attr : instanceAttrs) {
+    glVertexAttribDivisor(attr, 0);
+    glDisableVertexAttribArray(attr);
+  }
+
+  glDisableVertexAttribArray(coordAttr);
+  glDisableVertexAttribArray(texCoordAttr);
+
+  glBindTexture(GL_TEXTURE_2D, 0);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glUseProgram(0);
+}
+
+MeshBatch::MeshBatch() :
+  groupCount(0)
+{
+  glGenBuffers(1, &this->vbo);
+}
+
+MeshBatch::~MeshBatch() {
+  glDeleteBuffers(1, &this->vbo);
+}
+
+MeshBatch::Group &MeshBatch::GetGroup(const Mesh *mesh) {
+  for (int i = 0; i < this->groupCount; ++i)
+    if (this->groups[i].mesh == mesh)
+      return this->groups[i];
+
+  // Reuse a group left over from a previous frame, if any, so its
+  // storage is not reallocated every frame.
+  if (this->groupCount == this->groups.size())
+    this->groups.push_back(Group());
+
+  Group &group = this->groups[this->groupCount++];
+  group.mesh = mesh;
+  group.instances.clear();
+
+  return group;
+}
+
+void MeshBatch::Clear() {
+  this->groupCount = 0;
+}
+
+void MeshBatch::Add(const Mesh *mesh, const b2Vec2 &pos, float32 angle, float32 scale_factor) {
+  this->Add(mesh, pos, angle, scale_factor,
+            mesh->color.r, mesh->color.g, mesh->color.b, mesh->color.a);
+}
+
+void MeshBatch::Add(const Mesh *mesh, const b2Vec2 &pos, float32 angle, float32 scale_factor,
+                    float r, float g, float b, float a)
+{
+  this->GetGroup(mesh).instances.push_back({{pos.x, pos.y}, angle, scale_factor, {r, g, b, a}});
+}
+
+void MeshBatch::Draw() {
+  // Gather the instances of all groups into one contiguous array so
+  // they can be uploaded with a single call.
+  this->staging.clear();
+  for (int i = 0; i < this->groupCount; ++i)
+    this->staging.insert(this->staging.end(),
+                         this->groups[i].instances.begin(),
+                         this->groups[i].instances.end());
+
+  if (this->staging.empty())
+    return;
+
+  glBindBuffer(GL_ARRAY_BUFFER, this->vbo);
+  glBufferData(GL_ARRAY_BUFFER, this->staging.size() * sizeof(MeshInstance), this->staging.data(), GL_STREAM_DRAW);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  int first = 0;
+  for (int i = 0; i < this->groupCount; ++i) {
+    int count = this->groups[i].instances.size();
+    this->groups[i].mesh->DrawInstanced(this->vbo, first, count);
+    first += count;
+  }
+}
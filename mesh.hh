@@ -1,9 +1,22 @@
 #ifndef _GRAVITY_MESH_HH_
 #define _GRAVITY_MESH_HH_
 
-#include "glew.h"
+#include "gl-loader.hh"
 #include <Box2D/Box2D.h>
 
+#include <vector>
+
+using namespace std;
+
+/// Per-instance data for instanced drawing. The fields correspond to
+/// the per-object inputs of tex-poly-vertex-shader.glsl.
+struct MeshInstance {
+  GLfloat position[2];
+  GLfloat angle;
+  GLfloat scale_factor;
+  GLfloat color[4];
+};
+
 class Mesh {
 protected:
   GLuint vbo;
@@ -17,12 +30,52 @@ protected:
     float a;
   } color;
 
+  friend class MeshBatch;
+
 public:
   Mesh(const GLfloat *vertexData, int n, GLuint texture);
   ~Mesh();
 
   void SetColor(float r, float g, float b, float a);
   void Draw(const b2Vec2 &pos, float32 angle, float32 scale_factor=1.0f) const;
+
+  /// Draws `count` instances of the mesh, reading per-instance data
+  /// from `instanceBuffer` starting at instance number `first`.
+  void DrawInstanced(GLuint instanceBuffer, int first, int count) const;
+};
+
+/// Collects the instances of all meshes drawn in a frame into a single
+/// buffer and draws each mesh with one instanced call. Meshes are drawn
+/// in the order in which they were first added since the last Clear.
+class MeshBatch {
+protected:
+  struct Group {
+    const Mesh *mesh;
+    vector<MeshInstance> instances;
+  };
+
+  GLuint vbo;
+  vector<Group> groups;
+  int groupCount;
+  vector<MeshInstance> staging;
+
+  Group &GetGroup(const Mesh *mesh);
+
+public:
+  MeshBatch();
+  ~MeshBatch();
+
+  void Clear();
+
+  /// Adds an instance using the mesh's own color.
+  void Add(const Mesh *mesh, const b2Vec2 &pos, float32 angle, float32 scale_factor=1.0f);
+
+  /// Adds an instance with the given color.
+  void Add(const Mesh *mesh, const b2Vec2 &pos, float32 angle, float32 scale_factor,
+           float r, float g, float b, float a);
+
+  /// Uploads all instances and draws them.
+  void Draw();
 };
 
 #endif /* _GRAVITY_MESH_HH_ */
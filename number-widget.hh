@@ -11,8 +11,14 @@ protected:
   float width;
   TextAnchor xanchor;
   TextAnchor yanchor;
-  GLuint vbo;
   uint32_t ndigits;
+  uint32_t number;
+  GLuint texture;
+
+  // Index of the quad of the first digit in the HUD layer, or -1 if
+  // the widget is not currently laid out. The other digits follow.
+  int firstQuad;
+
   struct {
     float r;
     float g;
@@ -20,7 +26,11 @@ protected:
     float a;
   } color;
 
+  void GetDigits(uint32_t n, uint8_t *digits) const;
+
 public:
+  static const uint32_t MAX_DIGITS = 10;
+
   NumberWidget(Screen *screen, uint32_t n, float x, float y, float height, TextAnchor xanchor, TextAnchor yanchor, uint32_t ndigits, const SDL_Color &color={255, 255, 255, 255});
   virtual ~NumberWidget();
 
@@ -30,7 +40,7 @@ public:
 
   virtual void HandleEvent(const SDL_Event &e);
   virtual void Advance(float dt);
-  virtual void Render(Renderer *renderer);
+  virtual void Layout(HudLayer *hud);
   virtual void Reset();
 };
 
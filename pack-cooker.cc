@@ -0,0 +1,111 @@
+// gravity-cook: cooks the resources directory into a single pack file,
+// which the game maps at startup instead of reading and decoding the
+// separate files.
+//
+// Usage: gravity-cook <resources directory> <output file>
+
+#include "asset-pack.hh"
+#include "asset-manifest.hh"
+#include "image.hh"
+
+#include <dirent.h>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Images are halved until neither side is larger than this, the
+// largest texture size nearly all GPUs support. The game skips any mip
+// levels still too large for the GPU it runs on.
+const int MAX_TEXTURE_SIZE = 4096;
+
+// Returns the names of the files in `dir` ending in `extension`, with
+// the extension removed.
+vector<string> ListFiles(const string &dir, const string &extension) {
+  vector<string> names;
+
+  DIR *d = opendir(dir.data());
+  if (d == nullptr)
+    return names;
+
+  while (dirent *e = readdir(d)) {
+    string name = e->d_name;
+    if (name.size() > extension.size() &&
+        name.compare(name.size() - extension.size(), extension.size(), extension) == 0)
+      names.push_back(name.substr(0, name.size() - extension.size()));
+  }
+  closedir(d);
+
+  return names;
+}
+
+string ReadWholeFile(const string &filename) {
+  ifstream stream(filename, ifstream::in | ifstream::binary);
+  if (!stream) {
+    stringstream ss;
+    ss << "Cannot open file: " << filename;
+    throw runtime_error(ss.str());
+  }
+
+  stringstream ss;
+  ss << stream.rdbuf();
+  return ss.str();
+}
+
+int Cook(const string &resources, const string &output) {
+  AssetPackWriter writer;
+
+  // Every texture the game refers to, variants included.
+  for (int i = 0; i < (int) TextureId::COUNT; ++i) {
+    string name = GetResourceName((TextureId) i);
+    TextureVariant variant = AssetManifest::GetTextureVariant((TextureId) i);
+
+    TextureImage image = Images::Load(resources + "/images/" + variant.image + ".png", MAX_TEXTURE_SIZE);
+    Images::ApplyTransforms(image, variant.transforms);
+    Images::BuildMipChain(image);
+
+    writer.AddTexture("textures/" + name, image);
+    cout << "texture " << name << " (" << image.width << "x" << image.height
+         << ", " << image.levels << " levels)" << endl;
+
+    Images::Free(image);
+  }
+
+  const vector<pair<string, string>> files = {
+    {"shaders", ".glsl"},
+    {"sound", ".wav"},
+    {"fonts", ".ttf"},
+  };
+
+  for (auto &f : files)
+    for (auto &name : ListFiles(resources + "/" + f.first, f.second)) {
+      string path = f.first + "/" + name + f.second;
+      writer.AddFile(path, ReadWholeFile(resources + "/" + path));
+      cout << path << endl;
+    }
+
+  writer.Write(output);
+  cout << "Wrote " << output << endl;
+
+  return 0;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc != 3) {
+    cerr << "Usage: " << argv[0] << " <resources directory> <output file>" << endl;
+    return 1;
+  }
+
+  try {
+    return Cook(argv[1], argv[2]);
+  }
+  catch (runtime_error &e) {
+    cerr << "Error: " << e.what() << endl;
+    return 1;
+  }
+}
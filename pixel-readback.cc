@@ -0,0 +1,91 @@
+#include "pixel-readback.hh"
+#include "gl-diagnostics.hh"
+
+#include <cstring>
+
+PixelReadback::PixelReadback(int slotCount) :
+  slots(slotCount),
+  first(0),
+  count(0)
+{
+  for (auto &slot : this->slots) {
+    glGenBuffers(1, &slot.pbo);
+    slot.fence = nullptr;
+    slot.capacity = 0;
+    slot.width = 0;
+    slot.height = 0;
+  }
+}
+
+PixelReadback::~PixelReadback() {
+  for (auto &slot : this->slots) {
+    if (slot.fence)
+      glDeleteSync(slot.fence);
+    glDeleteBuffers(1, &slot.pbo);
+  }
+}
+
+bool PixelReadback::Start(int width, int height) {
+  if (this->count == (int) this->slots.size())
+    return false;
+
+  Slot &slot = this->slots[(this->first + this->count) % this->slots.size()];
+  size_t size = (size_t) width * height * 4;
+
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+  if (size > slot.capacity) {
+    glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+    slot.capacity = size;
+  }
+
+  // With a pack buffer bound, glReadPixels only queues the copy and
+  // returns right away.
+  glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, (void*) 0);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  GL_CHECK("pixel-readback");
+
+  slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  slot.width = width;
+  slot.height = height;
+  this->count++;
+
+  return true;
+}
+
+bool PixelReadback::Finish(PixelImage &image, bool wait) {
+  if (this->count == 0)
+    return false;
+
+  Slot &slot = this->slots[this->first];
+
+  GLenum status;
+  if (wait)
+    status = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+  else
+    status = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+  if (status == GL_TIMEOUT_EXPIRED)
+    return false;
+
+  glDeleteSync(slot.fence);
+  slot.fence = nullptr;
+
+  size_t size = (size_t) slot.width * slot.height * 4;
+  image.width = slot.width;
+  image.height = slot.height;
+  image.pixels.resize(size);
+
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+  void *data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+  if (data) {
+    memcpy(image.pixels.data(), data, size);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+  }
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  GL_CHECK("pixel-readback");
+
+  this->first = (this->first + 1) % this->slots.size();
+  this->count--;
+
+  return data != nullptr;
+}
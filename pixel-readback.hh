@@ -0,0 +1,56 @@
+#ifndef _GRAVITY_PIXEL_READBACK_HH_
+#define _GRAVITY_PIXEL_READBACK_HH_
+
+#include "gl-loader.hh"
+
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+/// Pixels read back from a framebuffer, as RGBA bytes. As with
+/// glReadPixels, the bottom row comes first.
+struct PixelImage {
+  int width;
+  int height;
+  vector<uint8_t> pixels;
+};
+
+/// Reads pixels back from the GPU without stalling. Each read goes into
+/// a pixel buffer object, and is only mapped once a fence says the GPU
+/// has finished with it, usually a frame or two later. Several reads
+/// can be in flight at once; they complete in the order they were
+/// started.
+class PixelReadback {
+protected:
+  struct Slot {
+    GLuint pbo;
+    GLsync fence;
+    size_t capacity;
+    int width;
+    int height;
+  };
+
+  vector<Slot> slots;
+  int first;
+  int count;
+
+public:
+  PixelReadback(int slotCount);
+  ~PixelReadback();
+
+  /// Starts reading the bottom-left width x height pixels of the
+  /// current read framebuffer. Returns false, and reads nothing, if all
+  /// slots are still in flight.
+  bool Start(int width, int height);
+
+  /// Takes the oldest read out if it has completed, or, with `wait`
+  /// set, once it has. Returns false if there was nothing to take.
+  bool Finish(PixelImage &image, bool wait = false);
+
+  /// Returns the number of reads in flight.
+  int GetPending() const { return this->count; }
+  int GetSlotCount() const { return this->slots.size(); }
+};
+
+#endif /* _GRAVITY_PIXEL_READBACK_HH_ */
@@ -1,3 +1,5 @@
+#include <cstddef>
+#include <cstdio>
 #include <string>
 
 using namespace std;
@@ -5,4 +7,22 @@ using namespace std;
 #define SHOW_MSG(msg) { stringstream ss; ss << msg; ShowMessage(ss.str()); }
 
 extern string GetUserHomeDirectory();
+
+/// Returns the directory for per-user cached data, which may not exist
+/// yet.
+extern string GetUserCacheDirectory();
 extern void ShowMessage(string msg);
+
+/// Creates a directory, unless it already exists. Its parent must
+/// exist. Returns false on failure.
+extern bool MakeDirectory(const string &path);
+
+/// Starts a shell command and returns a stream writing to its standard
+/// input, or nullptr on failure.
+extern FILE *OpenOutputPipe(const string &command);
+extern int CloseOutputPipe(FILE *pipe);
+
+/// Maps a whole file into memory, read-only, and sets `size` to its
+/// size. Returns nullptr on failure.
+extern const void *MapFile(const string &path, size_t &size);
+extern void UnmapFile(const void *data, size_t size);
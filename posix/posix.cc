@@ -3,6 +3,12 @@
 
 #include <unistd.h>
 #include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
 #include <pwd.h>
 
 using namespace std;
@@ -17,6 +23,54 @@ string GetUserHomeDirectory() {
   return dir;
 }
 
+string GetUserCacheDirectory() {
+  const char *dir = getenv("XDG_CACHE_HOME");
+  if (dir && dir[0] != '\0')
+    return dir;
+
+  return GetUserHomeDirectory() + "/.cache";
+}
+
 void ShowMessage(string msg) {
   cout << msg << endl;
 }
+
+bool MakeDirectory(const string &path) {
+  return mkdir(path.data(), 0755) == 0 || errno == EEXIST;
+}
+
+FILE *OpenOutputPipe(const string &command) {
+  // Get write errors instead of being killed when the command exits
+  // before we are done writing.
+  signal(SIGPIPE, SIG_IGN);
+  return popen(command.data(), "w");
+}
+
+int CloseOutputPipe(FILE *pipe) {
+  return pclose(pipe);
+}
+
+const void *MapFile(const string &path, size_t &size) {
+  int fd = open(path.data(), O_RDONLY);
+  if (fd == -1)
+    return nullptr;
+
+  struct stat st;
+  if (fstat(fd, &st) == -1 || st.st_size == 0) {
+    close(fd);
+    return nullptr;
+  }
+
+  // The mapping stays valid after the file is closed.
+  void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED)
+    return nullptr;
+
+  size = st.st_size;
+  return data;
+}
+
+void UnmapFile(const void *data, size_t size) {
+  munmap((void*) data, size);
+}
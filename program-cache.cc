@@ -0,0 +1,147 @@
+#include "program-cache.hh"
+#include "platform.hh"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+namespace ProgramCache {
+
+string cacheDirectory;
+bool enabled = false;
+
+// Appended to the key, so that binaries of a previous version of the
+// cache format are never picked up.
+const char *FORMAT_VERSION = "1";
+
+uint64_t Hash(const string &data, uint64_t hash = 14695981039346656037ULL) {
+  // 64-bit FNV-1a.
+  for (unsigned char c : data) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+
+  return hash;
+}
+
+string GetFilename(const string &key) {
+  return cacheDirectory + "/program-" + key + ".bin";
+}
+
+void Init(const string &directory) {
+  GLint formats = 0;
+  if (GLLoader::ARB_get_program_binary || GLLoader::VERSION_4_1)
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+
+  if (formats == 0) {
+    cout << "Program binaries not supported; shaders are compiled on every run." << endl;
+    return;
+  }
+
+  cacheDirectory = directory;
+  enabled = true;
+}
+
+bool IsEnabled() {
+  return enabled;
+}
+
+string MakeKey(const string &vertexSource, const string &fragmentSource) {
+  // A binary is only good for the driver that produced it; drivers
+  // also reject binaries of other versions, but not always gracefully.
+  uint64_t hash = Hash(vertexSource);
+  hash = Hash(string(1, '\0') + fragmentSource, hash);
+  hash = Hash((const char*) glGetString(GL_VENDOR), hash);
+  hash = Hash((const char*) glGetString(GL_RENDERER), hash);
+  hash = Hash((const char*) glGetString(GL_VERSION), hash);
+  hash = Hash(FORMAT_VERSION, hash);
+
+  stringstream ss;
+  ss << hex << setw(16) << setfill('0') << hash;
+  return ss.str();
+}
+
+GLuint Load(const string &key) {
+  if (!enabled)
+    return 0;
+
+  ifstream stream(GetFilename(key), ifstream::in | ifstream::binary);
+  if (!stream)
+    return 0;
+
+  GLenum format;
+  if (!stream.read((char*) &format, sizeof(format)))
+    return 0;
+
+  // Reading through the stream buffer never sets eofbit on the stream,
+  // so only an empty payload tells a truncated file apart.
+  vector<char> binary((istreambuf_iterator<char>(stream)), istreambuf_iterator<char>());
+  if (binary.empty())
+    return 0;
+
+  GLuint program = glCreateProgram();
+  glProgramBinary(program, format, binary.data(), binary.size());
+
+  // The driver may refuse binaries, e.g. after an update that did not
+  // change the version string.
+  GLint status;
+  glGetProgramiv(program, GL_LINK_STATUS, &status);
+  if (status == GL_FALSE) {
+    cout << "Cached program " << key << " rejected by the driver." << endl;
+    glDeleteProgram(program);
+    return 0;
+  }
+
+  return program;
+}
+
+void PrepareForSave(GLuint program) {
+  if (enabled)
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+}
+
+void Save(const string &key, GLuint program) {
+  if (!enabled)
+    return;
+
+  GLint length = 0;
+  glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+  if (length == 0)
+    return;
+
+  vector<char> binary(length);
+  GLenum format;
+  glGetProgramBinary(program, length, &length, &format, binary.data());
+
+  // The cache directory normally lives in a directory that may not
+  // exist yet either.
+  size_t slash = cacheDirectory.rfind('/');
+  if (slash != string::npos && slash > 0)
+    MakeDirectory(cacheDirectory.substr(0, slash));
+  if (!MakeDirectory(cacheDirectory)) {
+    cout << "Could not create " << cacheDirectory << "; programs will not be cached." << endl;
+    enabled = false;
+    return;
+  }
+
+  // Write under a temporary name first, so that a crash never leaves a
+  // truncated binary behind for the next run to trip over.
+  string filename = GetFilename(key);
+  string tmpFilename = filename + ".tmp";
+  ofstream stream(tmpFilename, ofstream::out | ofstream::binary);
+  stream.write((const char*) &format, sizeof(format));
+  stream.write(binary.data(), length);
+  stream.close();
+
+  remove(filename.data());
+  if (!stream || rename(tmpFilename.data(), filename.data()) != 0) {
+    cout << "Could not save program binary to " << filename << "." << endl;
+    remove(tmpFilename.data());
+  }
+}
+
+} // namespace ProgramCache
@@ -0,0 +1,42 @@
+#ifndef _GRAVITY_PROGRAM_CACHE_HH_
+#define _GRAVITY_PROGRAM_CACHE_HH_
+
+#include "gl-loader.hh"
+
+#include <string>
+
+using namespace std;
+
+/// Keeps linked shader programs on disk with glGetProgramBinary, so
+/// that later runs can load them instead of compiling the shaders.
+/// Binaries are keyed by the shader sources and by the driver, and
+/// anything missing, stale or rejected by the driver is simply
+/// compiled again.
+namespace ProgramCache {
+
+/// Sets up the cache in the given directory, which is created when
+/// needed. Does nothing if the driver cannot save program binaries.
+/// Must be called after the OpenGL context has been created.
+extern void Init(const string &directory);
+
+/// Returns true if programs can be saved and loaded.
+extern bool IsEnabled();
+
+/// Returns the key identifying the program linked from the given
+/// sources on this driver.
+extern string MakeKey(const string &vertexSource, const string &fragmentSource);
+
+/// Creates a program from the binary cached under `key`. Returns 0 if
+/// there is none, or if the driver rejects it.
+extern GLuint Load(const string &key);
+
+/// Prepares a program, before it is linked, so that its binary can be
+/// saved afterwards.
+extern void PrepareForSave(GLuint program);
+
+/// Saves the binary of a linked program under `key`.
+extern void Save(const string &key, GLuint program);
+
+} // namespace ProgramCache
+
+#endif /* _GRAVITY_PROGRAM_CACHE_HH_ */
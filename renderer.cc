@@ -1,12 +1,34 @@
 #include "renderer.hh"
 #include "resource-cache.hh"
+#include "frame-recorder.hh"
+#include "gl-diagnostics.hh"
 #include "platform.hh"
+#include "config.hh"
+#include "startup-profile.hh"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
 
 using namespace std;
 
+// The share of a frame the world pass may take on the GPU. The rest is
+// left for the upscale, the HUD and the driver.
+const float WORLD_PASS_SHARE = 0.75;
+
+// Below this share of the budget, the render scale is raised again.
+const float SCALE_UP_THRESHOLD = 0.7;
+const float SCALE_UP_STEP = 0.05;
+
+// The number of screenshots that can be read back at the same time.
+const int SCREENSHOT_SLOTS = 2;
+
+// Timer results lag a few frames behind, so after a change, the scale
+// is left alone until measurements taken at the new scale come in.
+const int SCALE_SETTLE_FRAMES = 8;
+
 Background::Background(SDL_Window *window, GLuint texture) :
   window(window),
   texture(texture),
@@ -19,13 +41,17 @@ Background::Background(SDL_Window *window, GLuint texture) :
   glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &this->textureHeight);
   glBindTexture(GL_TEXTURE_2D, 0);
 
+  ResourceCache::RetainTexture(this->texture);
+
   // Create background vertex buffer object.
   this->RebuildIfNecessary();
 }
 
 Background::~Background() {
   glDeleteBuffers(1, &this->vbo);
-  glDeleteTextures(1, &this->texture);
+
+  // The texture is shared with the other screens.
+  ResourceCache::ReleaseTexture(this->texture);
 }
 
 void Background::RebuildIfNecessary() {
@@ -101,8 +127,7 @@ void Background::Draw() {
   glVertexAttribPointer(texCoordAttr, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(GLfloat), (void*) (2 * sizeof(GLfloat)));
 
   glDrawArrays(GL_TRIANGLES, 0, 6);
-  if (glGetError() != GL_NO_ERROR)
-    cout << "renderer: OpenGL draw error." << endl;
+  GL_CHECK("renderer");
 
   glDisableVertexAttribArray(coordAttr);
   glDisableVertexAttribArray(texCoordAttr);
@@ -112,37 +137,256 @@ void Background::Draw() {
 }
 
 Renderer::Renderer(SDL_Window *window) :
-  window(window)
+  window(window),
+  worldTargetWidth(0),
+  worldTargetHeight(0),
+  worldWidth(0),
+  worldHeight(0),
+  worldOffscreen(false),
+  nextTimerQuery(0),
+  timerQueryActive(false),
+  screenshotRequested(false),
+  recorder(nullptr),
+  renderScale(1.0),
+  worldPassTime(0.0),
+  framesSinceScaleChange(0)
 {
+#ifndef RELEASE_BUILD
+  // Ask for a debug context so the driver reports errors through the
+  // KHR_debug callback.
+  SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, SDL_GL_CONTEXT_DEBUG_FLAG);
+#endif
+
   this->context = SDL_GL_CreateContext(window);
+  StartupProfile::Mark("gl-context");
 
-  // initialize glew
-  GLenum status = glewInit();
-  if (status != GLEW_OK) {
-    SHOW_MSG("Could not initialize GLEW.");
+  // Resolve the OpenGL functions the game uses.
+  string error;
+  if (!GLLoader::Init(error)) {
+    SHOW_MSG(error << " Make sure your video card driver is up to date.");
     exit(1);
   }
+  StartupProfile::Mark("gl-loader");
 
-  if (!GLEW_VERSION_3_3) {
-    SHOW_MSG("OpenGL version 3.3 not found. Make sure your video card driver is up to date.");
-    exit(1);
-  }
+  GLDiagnostics::Init();
 
   // Enable blending.
   glEnable(GL_BLEND);
   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+  // Create the uniform buffer shared by all programs.
+  this->view = {{1.0f, 1.0f}, {0.0f, 0.0f}, 1.0f, {0.0f, 0.0f, 0.0f}};
+  glGenBuffers(1, &this->viewBuffer);
+  glBindBuffer(GL_UNIFORM_BUFFER, this->viewBuffer);
+  glBufferData(GL_UNIFORM_BUFFER, sizeof(ViewUniforms), &this->view, GL_DYNAMIC_DRAW);
+  glBindBuffer(GL_UNIFORM_BUFFER, 0);
+  glBindBufferBase(GL_UNIFORM_BUFFER, ViewUniformBinding, this->viewBuffer);
+
+  // Create the offscreen world target. Its storage is allocated on
+  // first use.
+  glGenFramebuffers(1, &this->worldFbo);
+  glGenTextures(1, &this->worldTexture);
+
+  this->screenshotReadback = new PixelReadback(SCREENSHOT_SLOTS);
+
+  glGenQueries(TimerQueryCount, this->timerQueries);
+  for (int i = 0; i < TimerQueryCount; ++i)
+    this->timerQueryPending[i] = false;
+
+  // Aim for the refresh rate of the display, or the frame rate limit
+  // if that is lower.
+  int frameRate = 60;
+  SDL_DisplayMode mode;
+  if (SDL_GetWindowDisplayMode(window, &mode) == 0 && mode.refresh_rate > 0)
+    frameRate = mode.refresh_rate;
+  if (Config::FrameRate > 0)
+    frameRate = min(frameRate, Config::FrameRate);
+  this->worldPassBudget = WORLD_PASS_SHARE / frameRate;
+
+  int winw, winh;
+  SDL_GetWindowSize(window, &winw, &winh);
+  this->SetViewport(winw, winh);
+  StartupProfile::Mark("renderer");
 }
 
 Renderer::~Renderer() {
+  delete this->screenshotReadback;
+  glDeleteQueries(TimerQueryCount, this->timerQueries);
+  glDeleteTextures(1, &this->worldTexture);
+  glDeleteFramebuffers(1, &this->worldFbo);
+  glDeleteBuffers(1, &this->viewBuffer);
+}
 
+void Renderer::UpdateViewUniforms() {
+  glBindBuffer(GL_UNIFORM_BUFFER, this->viewBuffer);
+  glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(ViewUniforms), &this->view);
+  glBindBuffer(GL_UNIFORM_BUFFER, 0);
 }
 
-void Renderer::PresentScreen() const {
+void Renderer::PresentScreen() {
+  // Read the frame back from the back buffer before it is swapped out.
+  if (this->screenshotRequested) {
+    if (this->screenshotReadback->Start(this->view.resolution[0], this->view.resolution[1]))
+      this->screenshotRequested = false;
+  }
+
+  if (this->recorder)
+    this->recorder->Capture(this->view.resolution[0], this->view.resolution[1]);
+
   SDL_GL_SwapWindow(this->window);
 }
 
+void Renderer::RequestScreenshot() {
+  this->screenshotRequested = true;
+}
+
+void Renderer::SetRecorder(FrameRecorder *recorder) {
+  this->recorder = recorder;
+}
+
+bool Renderer::IsScreenshotPending() const {
+  return this->screenshotReadback->GetPending() > 0;
+}
+
+bool Renderer::TakeScreenshot(PixelImage &image) {
+  return this->screenshotReadback->Finish(image);
+}
+
 void Renderer::SetCamera(Camera &camera) {
   this->camera = camera;
+
+  this->view.camera_pos[0] = camera.pos.x;
+  this->view.camera_pos[1] = camera.pos.y;
+  this->view.ppm = camera.ppm;
+  this->UpdateViewUniforms();
+}
+
+void Renderer::SetViewport(int width, int height) {
+  glViewport(0, 0, width, height);
+
+  this->view.resolution[0] = width;
+  this->view.resolution[1] = height;
+  this->UpdateViewUniforms();
+}
+
+void Renderer::ResizeWorldTarget(int width, int height) {
+  glBindTexture(GL_TEXTURE_2D, this->worldTexture);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  glBindFramebuffer(GL_FRAMEBUFFER, this->worldFbo);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, this->worldTexture, 0);
+  if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    throw runtime_error("Could not create the world framebuffer.");
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  GL_CHECK("renderer");
+
+  this->worldTargetWidth = width;
+  this->worldTargetHeight = height;
+}
+
+void Renderer::CollectTimerQueries() {
+  // Go through the queries oldest first, stopping at the first one
+  // still waiting for the GPU; the ones after it cannot be done either.
+  for (int n = 0; n < TimerQueryCount; ++n) {
+    int i = (this->nextTimerQuery + n) % TimerQueryCount;
+    if (!this->timerQueryPending[i])
+      continue;
+
+    GLint available = 0;
+    glGetQueryObjectiv(this->timerQueries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available)
+      break;
+
+    GLuint64 elapsed;
+    glGetQueryObjectui64v(this->timerQueries[i], GL_QUERY_RESULT, &elapsed);
+    this->timerQueryPending[i] = false;
+    this->AdjustRenderScale(elapsed / 1e9f);
+  }
+}
+
+void Renderer::AdjustRenderScale(float seconds) {
+  // Smooth out the measurements a little so that a single slow frame
+  // does not change the resolution.
+  if (this->worldPassTime == 0.0)
+    this->worldPassTime = seconds;
+  else
+    this->worldPassTime += (seconds - this->worldPassTime) * 0.2f;
+
+  if (!Config::DynamicResolution || ++this->framesSinceScaleChange < SCALE_SETTLE_FRAMES)
+    return;
+
+  float scale = this->renderScale;
+  if (this->worldPassTime > this->worldPassBudget)
+    // The cost of the world pass mostly grows with the number of
+    // pixels, i.e. with the square of the scale.
+    scale *= sqrt(this->worldPassBudget / this->worldPassTime);
+  else if (this->worldPassTime < this->worldPassBudget * SCALE_UP_THRESHOLD)
+    scale += SCALE_UP_STEP;
+
+  scale = min(max(scale, Config::MinRenderScale), 1.0f);
+  if (fabs(scale - this->renderScale) >= 0.01f || (scale == 1.0f && this->renderScale != 1.0f)) {
+    this->renderScale = scale;
+    this->framesSinceScaleChange = 0;
+  }
+}
+
+void Renderer::BeginWorldPass() {
+  this->CollectTimerQueries();
+
+  // Only measure when the next query in the ring is free again. It
+  // almost always is; otherwise the GPU is more than a few frames
+  // behind and this frame is simply not measured.
+  if (!this->timerQueryPending[this->nextTimerQuery]) {
+    glBeginQuery(GL_TIME_ELAPSED, this->timerQueries[this->nextTimerQuery]);
+    this->timerQueryActive = true;
+  }
+
+  this->worldOffscreen = this->renderScale < 1.0f;
+  if (!this->worldOffscreen)
+    return;
+
+  int winw = this->view.resolution[0];
+  int winh = this->view.resolution[1];
+  if (winw != this->worldTargetWidth || winh != this->worldTargetHeight)
+    this->ResizeWorldTarget(winw, winh);
+
+  this->worldWidth = max(1, (int) lround(winw * this->renderScale));
+  this->worldHeight = max(1, (int) lround(winh * this->renderScale));
+
+  // The resolution seen by the shaders stays that of the window, so
+  // the world covers the same area, only with fewer pixels.
+  glBindFramebuffer(GL_FRAMEBUFFER, this->worldFbo);
+  glViewport(0, 0, this->worldWidth, this->worldHeight);
+  this->ClearScreen();
+}
+
+void Renderer::EndWorldPass() {
+  if (this->timerQueryActive) {
+    glEndQuery(GL_TIME_ELAPSED);
+    this->timerQueryPending[this->nextTimerQuery] = true;
+    this->nextTimerQuery = (this->nextTimerQuery + 1) % TimerQueryCount;
+    this->timerQueryActive = false;
+  }
+
+  if (!this->worldOffscreen)
+    return;
+
+  int winw = this->view.resolution[0];
+  int winh = this->view.resolution[1];
+
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, this->worldFbo);
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+  glBlitFramebuffer(0, 0, this->worldWidth, this->worldHeight,
+                    0, 0, winw, winh,
+                    GL_COLOR_BUFFER_BIT, GL_LINEAR);
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  GL_CHECK("renderer");
+
+  glViewport(0, 0, winw, winh);
+  this->worldOffscreen = false;
 }
 
 void Renderer::ClearScreen() {
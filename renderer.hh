@@ -3,6 +3,7 @@
 
 #include "mesh.hh"
 #include "camera.hh"
+#include "pixel-readback.hh"
 
 #include <SDL2/SDL.h>
 
@@ -10,6 +11,8 @@
 
 using namespace std;
 
+class FrameRecorder;
+
 enum class TextAnchor {
   LEFT,
   RIGHT,
@@ -38,19 +41,108 @@ public:
   void Draw();
 };
 
+/// The contents of the "View" uniform block, laid out according to
+/// the std140 rules.
+struct ViewUniforms {
+  GLfloat resolution[2];
+  GLfloat camera_pos[2];
+  GLfloat ppm;
+  GLfloat padding[3];
+};
+
 class Renderer {
 protected:
   SDL_Window *window;
   SDL_GLContext context;
   Camera camera;
 
+  ViewUniforms view;
+  GLuint viewBuffer;
+
+  // The offscreen target the world is drawn into when the render scale
+  // is below one. It is allocated at the full window size, and only
+  // the bottom-left part matching the current scale is used, so the
+  // scale can change without reallocating anything.
+  GLuint worldFbo;
+  GLuint worldTexture;
+  int worldTargetWidth;
+  int worldTargetHeight;
+  int worldWidth;
+  int worldHeight;
+  bool worldOffscreen;
+
+  // Timer queries measuring the GPU time of the world pass. Results
+  // become available a few frames late, so several are kept in flight.
+  static const int TimerQueryCount = 4;
+  GLuint timerQueries[TimerQueryCount];
+  bool timerQueryPending[TimerQueryCount];
+  int nextTimerQuery;
+  bool timerQueryActive;
+
+  // Screenshots are read back while presenting the frame after they
+  // were requested, and collected a frame or two later.
+  PixelReadback *screenshotReadback;
+  bool screenshotRequested;
+
+  FrameRecorder *recorder;
+
+  float renderScale;
+  float worldPassBudget;
+  float worldPassTime;
+  int framesSinceScaleChange;
+
+  void UpdateViewUniforms();
+  void ResizeWorldTarget(int width, int height);
+  void CollectTimerQueries();
+  void AdjustRenderScale(float seconds);
+
 public:
+  /// The binding point of the "View" uniform block, which holds the
+  /// camera and the resolution and is shared by all programs.
+  static const GLuint ViewUniformBinding = 0;
+
   Renderer(SDL_Window *window);
   virtual ~Renderer();
 
+  /// Sets the camera used for drawing the world. This is meant to be
+  /// called once per frame, before drawing.
   void SetCamera(Camera &camera);
+
+  /// Updates the OpenGL viewport and the resolution seen by the
+  /// shaders. Should be called when the window size changes.
+  void SetViewport(int width, int height);
+
+  /// Starts drawing the world. With dynamic resolution enabled, the
+  /// world is drawn into an offscreen buffer scaled down by the current
+  /// render scale.
+  void BeginWorldPass();
+
+  /// Finishes drawing the world, upscaling it into the window if it was
+  /// drawn offscreen, and adapts the render scale to the GPU time the
+  /// world has been taking. Anything drawn afterwards, such as the HUD,
+  /// is at native resolution.
+  void EndWorldPass();
+
+  /// The ratio of the world resolution to the window resolution.
+  float GetRenderScale() const { return this->renderScale; }
+
+  /// Captures the next frame presented. The pixels can be collected
+  /// with TakeScreenshot once the GPU has copied them.
+  void RequestScreenshot();
+
+  /// Returns true while a screenshot is being read back.
+  bool IsScreenshotPending() const;
+
+  /// Moves a completed screenshot into `image`. Returns false if there
+  /// is none yet.
+  bool TakeScreenshot(PixelImage &image);
+
+  /// Sets a recorder to capture every frame presented from now on, or
+  /// stops capturing if nullptr. The recorder is not owned.
+  void SetRecorder(FrameRecorder *recorder);
+
   void ClearScreen();
-  void PresentScreen() const;
+  void PresentScreen();
 };
 
 #endif /* _GRAVITY_RENDERER_HH_ */
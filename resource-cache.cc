@@ -1,20 +1,27 @@
 #include "resource-cache.hh"
+#include "renderer.hh"
 #include "helpers.hh"
+#include "config.hh"
 #include "platform.hh"
+#include "gl-diagnostics.hh"
+#include "asset-manifest.hh"
+#include "asset-pack.hh"
+#include "program-cache.hh"
+#include "hud-layer.hh"
+#include "startup-profile.hh"
 
-#define STB_IMAGE_IMPLEMENTATION
-#include "stb_image.h"
-#include "glew.h"
+#include "gl-loader.hh"
 
 #include <SDL2/SDL_ttf.h>
 #include <SDL2/SDL_mixer.h>
 
-#include <tuple>
 #include <string>
 #include <sstream>
 #include <map>
 #include <vector>
 #include <algorithm>
+#include <iomanip>
+#include <tuple>
 
 using namespace std;
 
@@ -23,23 +30,58 @@ namespace ResourceCache {
 string RESOURCES_PATH = "./resources";
 
 GLuint texturedPolygonProgram = 0;
-GLuint hudTexturedPolygonProgram = 0;
+GLuint hudProgram = 0;
 GLuint textProgram = 0;
 GLuint backgroundProgram = 0;
+GLuint circleProgram = 0;
 
-struct FontDescriptor {
-  string path;
-  int size;
+bool preloadDone = false;
 
-  bool operator<(const FontDescriptor &rhs) const {
-    return std::tie(this->path, this->size) < std::tie(rhs.path, rhs.size);
-  }
+// Text is rendered at the smallest of these sizes that is at least
+// as large as the text, and scaled down when drawn. Keeping the set
+// small means a window resize almost never needs a new atlas.
+const int FONT_SIZES[] = {12, 16, 20, 24, 32, 40, 48, 64, 80, 96, 128, 160, 192, 256};
+
+// Nothing used more recently than this is evicted, so that e.g. a font
+// atlas cannot go away while a layout that just used it is built.
+const Uint32 MIN_EVICTION_AGE = 1000;
+
+struct TextureEntry {
+  GLuint texture;
+  size_t bytes;
+  int refs;
+  Uint32 lastUse;
+};
+
+struct SoundEntry {
+  Mix_Chunk *chunk;
+  size_t bytes;
+  Uint32 lastUse;
 };
 
+struct FontAtlasEntry {
+  FontAtlas *atlas;
+  Uint32 lastUse;
+};
+
+// The cooked resources, if there is a pack. Anything not in the pack
+// is loaded from the resources directory.
+AssetPack *pack = nullptr;
+
 map<GLenum, string> shaderTypeNames;
-map<FontDescriptor, TTF_Font*> font_cache;
-map<string, Mix_Chunk*> sound_cache;
-map<string, GLuint> texture_cache;
+// Font atlases are keyed by font and size; textures and sounds are
+// indexed by id, and not loaded while null.
+map<pair<FontId, int>, FontAtlasEntry> font_atlas_cache;
+size_t fontAtlasBytes = 0;
+int fontGeneration = 0;
+SoundEntry sounds[(int) SoundId::COUNT];
+size_t soundBytes = 0;
+TextureEntry textures[(int) TextureId::COUNT];
+size_t textureBytes = 0;
+
+// Queried once on the main thread, since textures are decoded on the
+// loader threads where there is no GL context.
+int maxTextureSize = 0;
 
 GLuint CreateShader(GLenum shaderType, const string &shaderSource) {
   string shaderTypeName = shaderTypeNames[shaderType];
@@ -80,6 +122,7 @@ GLuint CreateProgram(const vector<GLuint> &shaders) {
   for (auto shader : shaders)
     glAttachShader(program, shader);
 
+  ProgramCache::PrepareForSave(program);
   glLinkProgram(program);
 
   GLint status;
@@ -99,16 +142,59 @@ GLuint CreateProgram(const vector<GLuint> &shaders) {
   return program;
 }
 
-GLuint CreateProgram(string vertexShaderFilename, string fragmentShaderFilename) {
-  vector<GLuint> shaders;
-  string vertexShaderSource = ReadFile(vertexShaderFilename);
-  string fragmentShaderSource = ReadFile(fragmentShaderFilename);
-  shaders.push_back(CreateShader(GL_VERTEX_SHADER, vertexShaderSource));
-  shaders.push_back(CreateShader(GL_FRAGMENT_SHADER, fragmentShaderSource));
+// Binds the shared camera/resolution block, if the program uses it.
+// Block bindings are not part of program binaries, so this is needed
+// however the program was created.
+void BindViewBlock(GLuint program) {
+  GLuint viewBlock = glGetUniformBlockIndex(program, "View");
+  if (viewBlock != GL_INVALID_INDEX)
+    glUniformBlockBinding(program, viewBlock, Renderer::ViewUniformBinding);
+}
 
-  GLuint program = CreateProgram(shaders);
-  for_each(shaders.begin(), shaders.end(), glDeleteShader);
+// Returns the contents of a file in the resources directory, given
+// its path relative to that directory.
+string ReadResource(const string &path) {
+  if (pack) {
+    const PackEntry *entry = pack->Find(path);
+    if (entry)
+      return string((const char*) pack->GetData(*entry), entry->size);
+  }
 
+  return ReadFile(RESOURCES_PATH + "/" + path);
+}
+
+// Returns a stream reading a file in the resources directory, either
+// from the pack or from disk.
+SDL_RWops *OpenResource(const string &path) {
+  if (pack) {
+    const PackEntry *entry = pack->Find(path);
+    if (entry)
+      return SDL_RWFromConstMem(pack->GetData(*entry), entry->size);
+  }
+
+  return SDL_RWFromFile((RESOURCES_PATH + "/" + path).data(), "rb");
+}
+
+GLuint CreateProgram(string vertexShaderFilename, string fragmentShaderFilename) {
+  string vertexShaderSource = ReadResource(vertexShaderFilename);
+  string fragmentShaderSource = ReadResource(fragmentShaderFilename);
+
+  // Skip compiling altogether if a previous run left a binary of the
+  // same sources behind.
+  string key = ProgramCache::MakeKey(vertexShaderSource, fragmentShaderSource);
+  GLuint program = ProgramCache::Load(key);
+  if (program == 0) {
+    vector<GLuint> shaders;
+    shaders.push_back(CreateShader(GL_VERTEX_SHADER, vertexShaderSource));
+    shaders.push_back(CreateShader(GL_FRAGMENT_SHADER, fragmentShaderSource));
+
+    program = CreateProgram(shaders);
+    for_each(shaders.begin(), shaders.end(), glDeleteShader);
+
+    ProgramCache::Save(key, program);
+  }
+
+  BindViewBlock(program);
   return program;
 }
 
@@ -136,191 +222,426 @@ void Init() {
        << Mix_GetError();
     throw runtime_error(ss.str());
   }
+  StartupProfile::Mark("fonts-and-audio");
+
+  // Use the cooked resources, if they have been built.
+  pack = new AssetPack();
+  if (pack->Open(RESOURCES_PATH + "/gravity.pack"))
+    cout << "Using resource pack." << endl;
+  else {
+    delete pack;
+    pack = nullptr;
+  }
+  StartupProfile::Mark("resource-pack");
+
+  glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
 
   // Compile shaders.
   cout << "Compiling shaders..." << endl;
 
+  ProgramCache::Init(GetUserCacheDirectory() + "/gravity");
+
   shaderTypeNames[GL_VERTEX_SHADER] = "vertex";
   shaderTypeNames[GL_GEOMETRY_SHADER] = "geometry";
   shaderTypeNames[GL_FRAGMENT_SHADER] = "fragment";
 
-  texturedPolygonProgram = CreateProgram(RESOURCES_PATH + "/shaders/tex-poly-vertex-shader.glsl",
-                                         RESOURCES_PATH + "/shaders/tex-poly-fragment-shader.glsl");
+  texturedPolygonProgram = CreateProgram("shaders/tex-poly-vertex-shader.glsl",
+                                         "shaders/tex-poly-fragment-shader.glsl");
 
-  hudTexturedPolygonProgram = CreateProgram(RESOURCES_PATH + "/shaders/hud-tex-poly-vertex-shader.glsl",
-                                            RESOURCES_PATH + "/shaders/tex-poly-fragment-shader.glsl");
+  hudProgram = CreateProgram("shaders/hud-vertex-shader.glsl",
+                             "shaders/hud-fragment-shader.glsl");
 
-  textProgram = CreateProgram(RESOURCES_PATH + "/shaders/text-vertex-shader.glsl",
-                              RESOURCES_PATH + "/shaders/text-fragment-shader.glsl");
+  textProgram = CreateProgram("shaders/text-vertex-shader.glsl",
+                              "shaders/text-fragment-shader.glsl");
 
-  backgroundProgram = CreateProgram(RESOURCES_PATH + "/shaders/background-vertex-shader.glsl",
-                                    RESOURCES_PATH + "/shaders/background-fragment-shader.glsl");
+  backgroundProgram = CreateProgram("shaders/background-vertex-shader.glsl",
+                                    "shaders/background-fragment-shader.glsl");
+
+  circleProgram = CreateProgram("shaders/circle-vertex-shader.glsl",
+                                "shaders/circle-fragment-shader.glsl");
+  StartupProfile::Mark("shaders");
 
   cout << "Resource cache initialized." << endl;
 }
 
 void Finalize() {
-  for (auto p : font_cache)
-    TTF_CloseFont(p.second);
-
-  for (auto p : sound_cache)
-    Mix_FreeChunk(p.second);
+  for (auto p : font_atlas_cache)
+    delete p.second.atlas;
+  font_atlas_cache.clear();
+  fontAtlasBytes = 0;
+
+  for (auto &entry : sounds) {
+    if (entry.chunk)
+      Mix_FreeChunk(entry.chunk);
+    entry = {};
+  }
+  soundBytes = 0;
 
   TTF_Quit();
   Mix_Quit();
+
+  delete pack;
+  pack = nullptr;
+}
+
+// Drops the least recently used atlases until the cache is within
+// its budget again.
+void TrimFontAtlases() {
+  Uint32 now = SDL_GetTicks();
+
+  while (fontAtlasBytes > (size_t) Config::FontCacheSize) {
+    auto oldest = font_atlas_cache.end();
+    for (auto it = font_atlas_cache.begin(); it != font_atlas_cache.end(); ++it) {
+      if (now - it->second.lastUse >= MIN_EVICTION_AGE &&
+          (oldest == font_atlas_cache.end() || it->second.lastUse < oldest->second.lastUse))
+        oldest = it;
+    }
+
+    if (oldest == font_atlas_cache.end())
+      break;
+
+    cout << "Evicting font atlas " << GetResourceName(oldest->first.first)
+         << " for size " << oldest->first.second << "." << endl;
+    fontAtlasBytes -= oldest->second.atlas->GetByteSize();
+    delete oldest->second.atlas;
+    font_atlas_cache.erase(oldest);
+    fontGeneration++;
+  }
 }
 
-TTF_Font *GetFont(int height_pixels) {
-  FontDescriptor desc {"fonts/UbuntuMono-B.ttf", height_pixels};
+int GetFontSize(int height_pixels) {
+  for (auto size : FONT_SIZES) {
+    if (size >= height_pixels)
+      return size;
+  }
+
+  // Text larger than the largest size is scaled up.
+  return FONT_SIZES[sizeof(FONT_SIZES) / sizeof(FONT_SIZES[0]) - 1];
+}
 
-  auto it = font_cache.find(desc);
-  if (it != font_cache.end())
-    return it->second;
+const FontAtlas *GetFontAtlas(FontId id, int height_pixels) {
+  auto key = make_pair(id, GetFontSize(height_pixels));
 
-  TTF_Font *font = TTF_OpenFont((RESOURCES_PATH + "/fonts/kenvector_future.ttf").data(), height_pixels);
+  auto it = font_atlas_cache.find(key);
+  if (it != font_atlas_cache.end()) {
+    it->second.lastUse = SDL_GetTicks();
+    return it->second.atlas;
+  }
+
+  cout << "Creating font atlas " << GetResourceName(id) << " for size " << key.second << "." << endl;
+
+  // The font itself is only needed to render the glyphs.
+  string path = string("fonts/") + GetResourceName(id) + ".ttf";
+  TTF_Font *font = TTF_OpenFontRW(OpenResource(path), 1, key.second);
   if (font == nullptr) {
     stringstream ss;
     ss << "Unable to load font. SDL_ttf error: " << TTF_GetError();
     throw runtime_error(ss.str());
   }
 
-  font_cache[desc] = font;
+  FontAtlas *atlas = new FontAtlas(font, key.second);
+  TTF_CloseFont(font);
+
+  font_atlas_cache[key] = {atlas, SDL_GetTicks()};
+  fontAtlasBytes += atlas->GetByteSize();
+  TrimFontAtlases();
+
+  return atlas;
+}
+
+int GetFontGeneration() {
+  return fontGeneration;
+}
+
+// Returns true if a sound is playing on any channel.
+bool IsPlaying(Mix_Chunk *chunk) {
+  int channels = Mix_AllocateChannels(-1);
+  for (int i = 0; i < channels; ++i) {
+    if (Mix_Playing(i) && Mix_GetChunk(i) == chunk)
+      return true;
+  }
+
+  return false;
+}
+
+// Frees the least recently played sounds, other than those still
+// playing, until the cache is within its budget again.
+void TrimSounds() {
+  Uint32 now = SDL_GetTicks();
+
+  while (soundBytes > (size_t) Config::SoundCacheSize) {
+    SoundEntry *oldest = nullptr;
+    for (auto &entry : sounds) {
+      if (entry.chunk && now - entry.lastUse >= MIN_EVICTION_AGE && !IsPlaying(entry.chunk) &&
+          (oldest == nullptr || entry.lastUse < oldest->lastUse))
+        oldest = &entry;
+    }
+
+    if (oldest == nullptr)
+      break;
 
-  return font;
+    cout << "Evicting sound " << GetResourceName((SoundId) (oldest - sounds)) << "." << endl;
+    soundBytes -= oldest->bytes;
+    Mix_FreeChunk(oldest->chunk);
+    *oldest = {};
+  }
 }
 
-Mix_Chunk *GetSound(const string &name) {
-  auto it = sound_cache.find(name);
-  if (it != sound_cache.end())
-    return it->second;
+Mix_Chunk *GetSound(SoundId id) {
+  SoundEntry &entry = sounds[(int) id];
+  if (entry.chunk) {
+    entry.lastUse = SDL_GetTicks();
+    return entry.chunk;
+  }
+
+#ifndef RELEASE_BUILD
+  if (preloadDone)
+    cout << "Warning: sound " << GetResourceName(id) << " loaded on first use." << endl;
+#endif
 
-  Mix_Chunk *chunk = Mix_LoadWAV((RESOURCES_PATH + "/sound/" + name + ".wav").data());
+  Mix_Chunk *chunk = DecodeSound(id);
+  AddSound(id, chunk);
+
+  return chunk;
+}
+
+Mix_Chunk *DecodeSound(SoundId id) {
+  // This only reads and converts the file; unlike playing sounds, it
+  // does not touch the mixer state.
+  string path = string("sound/") + GetResourceName(id) + ".wav";
+  Mix_Chunk *chunk = Mix_LoadWAV_RW(OpenResource(path), 1);
   if (chunk == nullptr) {
     stringstream ss;
     ss << "Unable to load sound. SDL_mixer error: " << Mix_GetError();
     throw runtime_error(ss.str());
   }
 
-  sound_cache[name] = chunk;
-
   return chunk;
 }
 
-// This is adapted from libSOIL source code, specifically from
-// image_helper.c source file in which this function is called
-// mipmap_image.
-int downscale_image(const unsigned char* const orig,
-                    int width, int height, int channels,
-                    unsigned char* resampled,
-                    int new_width, int new_height)
-{
-  int i, j, c;
-  int block_size_x = width / new_width;
-  int block_size_y = height / new_height;
-
-  // error check
-  if((width < 1) || (height < 1) ||
-     (channels < 1) || (orig == NULL) ||
-     (resampled == NULL) ||
-     (block_size_x < 1) || (block_size_y < 1))
-  {
-    // nothing to do
-    return 0;
+void AddSound(SoundId id, Mix_Chunk *chunk) {
+  SoundEntry &entry = sounds[(int) id];
+  if (entry.chunk) {
+    soundBytes -= entry.bytes;
+    Mix_FreeChunk(entry.chunk);
   }
 
-  if( new_width < 1 ) {
-    new_width = 1;
-  }
-  if(new_height < 1) {
-    new_height = 1;
-  }
-  for (j = 0; j < new_height; ++j) {
-    for(i = 0; i < new_width; ++i) {
-      for( c = 0; c < channels; ++c ) {
-        const int index = (j*block_size_y)*width*channels + (i*block_size_x)*channels + c;
-        int sum_value;
-        int u, v;
-        int u_block = block_size_x;
-        int v_block = block_size_y;
-        int block_area;
-
-        // do a bit of checking so we don't over-run the boundaries
-        // (necessary for non-square textures)
-        if(block_size_x * (i+1) > width) {
-          u_block = width - i*block_size_y;
-        }
-        if(block_size_y * (j+1) > height) {
-          v_block = height - j*block_size_y;
-        }
-
-        block_area = u_block*v_block;
-
-        // for this pixel, see what the average of all the values in
-        // the block are.  note: start the sum at the rounding value,
-        // not at 0
-        sum_value = block_area >> 1;
-        for( v = 0; v < v_block; ++v )
-          for( u = 0; u < u_block; ++u )
-            sum_value += orig[index + v*width*channels + u*channels];
-
-        resampled[j*new_width*channels + i*channels + c] = sum_value / block_area;
-      }
-    }
-  }
+  entry = {chunk, chunk->alen, SDL_GetTicks()};
+  soundBytes += chunk->alen;
+  TrimSounds();
+}
 
-  return 1;
+bool HasSound(SoundId id) {
+  return sounds[(int) id].chunk != nullptr;
 }
 
-GLuint GetTexture(const string &name, const string &type) {
-  auto it = texture_cache.find(name);
-  if (it != texture_cache.end())
-    return it->second;
+// Deletes a cached texture, along with its copies in the HUD atlas.
+void DeleteTexture(TextureEntry &entry) {
+  HudLayer::ForgetTexture(entry.texture);
+  glDeleteTextures(1, &entry.texture);
+}
 
-  int w, h, channels;
-  uint8_t *img = stbi_load((RESOURCES_PATH + "/images/" + name + "." + type).data(), &w, &h, &channels, 0);
-  if (img == nullptr) {
-    stringstream ss;
-    ss << "Unable to load image. stb_image error: "
-       << stbi_failure_reason();
-    throw runtime_error(ss.str());
+// Deletes the least recently used textures that nothing holds on to,
+// until the cache is within its budget again. The HUD atlas cannot be
+// evicted, but counts against the budget all the same.
+void TrimTextures() {
+  Uint32 now = SDL_GetTicks();
+
+  while (textureBytes + HudLayer::GetAtlasBytes() > (size_t) Config::TextureCacheSize) {
+    TextureEntry *oldest = nullptr;
+    for (auto &entry : textures) {
+      if (entry.texture && entry.refs == 0 && now - entry.lastUse >= MIN_EVICTION_AGE &&
+          (oldest == nullptr || entry.lastUse < oldest->lastUse))
+        oldest = &entry;
+    }
+
+    if (oldest == nullptr)
+      break;
+
+    cout << "Evicting texture " << GetResourceName((TextureId) (oldest - textures)) << "." << endl;
+    textureBytes -= oldest->bytes;
+    DeleteTexture(*oldest);
+    *oldest = {};
   }
+}
 
-  int nw = w;
-  int nh = h;
-  while (nw > GL_MAX_TEXTURE_SIZE || h > GL_MAX_TEXTURE_SIZE) {
-    nw /= 2;
-    nh /= 2;
+GLuint GetTexture(TextureId id) {
+  TextureEntry &entry = textures[(int) id];
+  if (entry.texture) {
+    entry.lastUse = SDL_GetTicks();
+    return entry.texture;
   }
 
-  if (nw != w || nh != h) {
-    uint8_t *resampled = new uint8_t[nw * nh * channels];
+#ifndef RELEASE_BUILD
+  if (preloadDone)
+    cout << "Warning: texture " << GetResourceName(id) << " loaded on first use." << endl;
+#endif
+
+  TextureImage image = DecodeTexture(id);
+  return UploadTexture(id, image);
+}
+
+TextureImage DecodeTexture(TextureId id) {
+  if (pack) {
+    const PackEntry *entry = pack->Find(string("textures/") + GetResourceName(id));
+    if (entry && entry->type == PackEntryType::TEXTURE) {
+      // Cooked textures come with their mip chain; levels too large
+      // for the GPU are simply skipped.
+      TextureImage image = {(int) entry->width, (int) entry->height, (int) entry->levels,
+                            (uint8_t*) pack->GetData(*entry), false, false};
+      while ((image.width > maxTextureSize || image.height > maxTextureSize) && image.levels > 1) {
+        image.pixels += (size_t) image.width * image.height * 4;
+        image.width = Images::GetLevelSize(image.width, 1);
+        image.height = Images::GetLevelSize(image.height, 1);
+        image.levels--;
+      }
 
-    downscale_image(img, w, h, channels, resampled, nw, nh);
-    stbi_image_free(img);
-    img = resampled;
-    w = nw;
-    h = nh;
+      return image;
+    }
   }
 
+  TextureVariant variant = AssetManifest::GetTextureVariant(id);
+
+  TextureImage image = Images::Load(RESOURCES_PATH + "/images/" + variant.image + ".png", maxTextureSize);
+  Images::ApplyTransforms(image, variant.transforms);
+
+  // Build the mip chain here rather than with glGenerateMipmap, so
+  // that the work is done on the loader threads instead of stalling
+  // the driver on the main thread.
+  Images::BuildMipChain(image);
+
+  return image;
+}
+
+GLuint UploadTexture(TextureId id, TextureImage &image) {
+  if (image.levels == 1)
+    Images::BuildMipChain(image);
+
   GLuint texture;
   glGenTextures(1, &texture);
   glBindTexture(GL_TEXTURE_2D, texture);
-  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, img);
-  auto err = glGetError();
-  if (err != GL_NO_ERROR)
-    cout << "OpenGL error " << err << " while loading image: " << name << endl;
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
-  glBindTexture(GL_TEXTURE_2D, 0);
 
-  // Generate mipmaps.
-  glBindTexture(GL_TEXTURE_2D, texture);
-  glGenerateMipmap(GL_TEXTURE_2D);
+  for (int level = 0; level < image.levels; ++level)
+    glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA,
+                 Images::GetLevelSize(image.width, level), Images::GetLevelSize(image.height, level), 0,
+                 GL_RGBA, GL_UNSIGNED_BYTE,
+                 image.pixels + Images::GetLevelOffset(image.width, image.height, level));
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, image.levels - 1);
+  GL_CHECK("resource-cache");
+
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
   glBindTexture(GL_TEXTURE_2D, 0);
 
-  texture_cache[name] = texture;
+  // The whole mip chain counts; the driver may well keep a copy in
+  // system memory too, which is not.
+  size_t bytes = Images::GetLevelOffset(image.width, image.height, image.levels);
+  Images::Free(image);
+
+  // A texture loaded again keeps the references to the old one.
+  TextureEntry &entry = textures[(int) id];
+  if (entry.texture) {
+    textureBytes -= entry.bytes;
+    DeleteTexture(entry);
+  }
+
+  entry = {texture, bytes, entry.refs, SDL_GetTicks()};
+  textureBytes += bytes;
+  TrimTextures();
 
   return texture;
 }
 
+// Returns the cache entry of a texture, or nullptr if it is not from
+// the cache. Only used when retaining and releasing, which is rare
+// enough for a linear search.
+TextureEntry *FindTexture(GLuint texture) {
+  for (auto &entry : textures) {
+    if (entry.texture == texture && texture != 0)
+      return &entry;
+  }
+
+  return nullptr;
+}
+
+void RetainTexture(GLuint texture) {
+  TextureEntry *entry = FindTexture(texture);
+  if (entry)
+    entry->refs++;
+}
+
+void ReleaseTexture(GLuint texture) {
+  TextureEntry *entry = FindTexture(texture);
+  if (entry) {
+    entry->refs--;
+    entry->lastUse = SDL_GetTicks();
+  }
+}
+
+bool HasTexture(TextureId id) {
+  return textures[(int) id].texture != 0;
+}
+
+MemoryUsage GetMemoryUsage(AssetType type) {
+  size_t count = 0;
+
+  switch (type) {
+  case AssetType::TEXTURE:
+    for (auto &entry : textures)
+      count += entry.texture != 0;
+    // The HUD atlas is counted as one more texture.
+    if (HudLayer::GetAtlasBytes() > 0)
+      count++;
+    return {textureBytes + HudLayer::GetAtlasBytes(), (size_t) Config::TextureCacheSize, count};
+
+  case AssetType::SOUND:
+    for (auto &entry : sounds)
+      count += entry.chunk != nullptr;
+    return {soundBytes, (size_t) Config::SoundCacheSize, count};
+
+  case AssetType::FONT:
+    return {fontAtlasBytes, (size_t) Config::FontCacheSize, font_atlas_cache.size()};
+  }
+
+  return {0, 0, 0};
+}
+
+void PrintMemoryUsage() {
+  const pair<AssetType, const char*> types[] = {
+    {AssetType::TEXTURE, "Textures"},
+    {AssetType::SOUND, "Sounds"},
+    {AssetType::FONT, "Font atlases"},
+  };
+
+  for (auto &type : types) {
+    MemoryUsage usage = GetMemoryUsage(type.first);
+    cout << type.second << ": " << usage.count << " using "
+         << usage.bytes / 1024 << " of " << usage.budget / 1024 << " KiB" << endl;
+  }
+
+  // Then every item, largest first.
+  vector<tuple<size_t, string, int>> items;
+  for (int i = 0; i < (int) TextureId::COUNT; ++i) {
+    if (textures[i].texture)
+      items.push_back(make_tuple(textures[i].bytes, string("texture ") + GetResourceName((TextureId) i), textures[i].refs));
+  }
+  if (HudLayer::GetAtlasBytes() > 0)
+    items.push_back(make_tuple(HudLayer::GetAtlasBytes(), string("HUD atlas"), -1));
+  for (int i = 0; i < (int) SoundId::COUNT; ++i) {
+    if (sounds[i].chunk)
+      items.push_back(make_tuple(sounds[i].bytes, string("sound ") + GetResourceName((SoundId) i), -1));
+  }
+  for (auto &p : font_atlas_cache)
+    items.push_back(make_tuple(p.second.atlas->GetByteSize(),
+                               string("font atlas ") + GetResourceName(p.first.first) + " " + to_string(p.first.second), -1));
+  sort(items.rbegin(), items.rend());
+
+  for (auto &item : items) {
+    cout << "  " << setw(8) << get<0>(item) / 1024 << " KiB  " << get<1>(item);
+    if (get<2>(item) >= 0)
+      cout << " (" << get<2>(item) << " refs)";
+    cout << endl;
+  }
+}
+
 } // namespace ResourceCache
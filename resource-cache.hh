@@ -1,30 +1,98 @@
 #ifndef _GRAVITY_RESOURCE_CACHE_HH_
 #define _GRAVITY_RESOURCE_CACHE_HH_
 
-#include "glew.h"
+#include "gl-loader.hh"
+#include "font-atlas.hh"
+#include "image.hh"
+#include "asset-manifest.hh"
+#include "resource-ids.hh"
 
 #include <SDL2/SDL_ttf.h>
 #include <SDL2/SDL_mixer.h>
 
+#include <cstddef>
 #include <string>
 
 using namespace std;
 
 namespace ResourceCache {
 
+/// The memory held by one kind of resource.
+struct MemoryUsage {
+  size_t bytes;
+  size_t budget;
+  size_t count;
+};
+
 extern string RESOURCES_PATH;
 
 extern GLuint texturedPolygonProgram;
-extern GLuint hudTexturedPolygonProgram;
+extern GLuint hudProgram;
 extern GLuint textProgram;
 extern GLuint backgroundProgram;
+extern GLuint circleProgram;
 
 extern void Init();
 extern void Finalize();
 
-extern TTF_Font *GetFont(int height_pixels);
-extern Mix_Chunk *GetSound(const string &name);
-extern GLuint GetTexture(const string &name, const string &type="png");
+/// Returns the size text of the given pixel height is rendered at.
+/// Heights are rounded up to a few size buckets, so that all text of
+/// similar size shares one atlas.
+extern int GetFontSize(int height_pixels);
+
+/// Returns the glyph atlas to draw text of the given pixel height
+/// with in the given font. Atlases not used for a while are evicted once they take more
+/// than Config::FontCacheSize bytes, so the returned atlas is only
+/// good until the font generation changes.
+extern const FontAtlas *GetFontAtlas(FontId id, int height_pixels);
+
+/// Incremented whenever font atlases are evicted.
+extern int GetFontGeneration();
+extern Mix_Chunk *GetSound(SoundId id);
+
+/// Returns a texture, loading it if necessary. Once the cache is over
+/// Config::TextureCacheSize bytes, textures that are not retained are
+/// evicted, least recently used first, so anything holding on to a
+/// texture must retain it.
+extern GLuint GetTexture(TextureId id);
+
+/// Keeps a cached texture from being evicted until it is released as
+/// many times. Textures not from the cache are ignored.
+extern void RetainTexture(GLuint texture);
+extern void ReleaseTexture(GLuint texture);
+
+/// Decodes the image of a texture into RGBA pixels. Unlike the rest of
+/// the resource cache, this may be called from any thread. Throws a
+/// runtime_error on failure.
+extern TextureImage DecodeTexture(TextureId id);
+
+/// Uploads a decoded image and adds it to the cache. The pixels are
+/// freed.
+extern GLuint UploadTexture(TextureId id, TextureImage &image);
+
+/// Loads a sound, converted to the output format. May be called from
+/// any thread once the audio device is open. Throws a runtime_error on
+/// failure.
+extern Mix_Chunk *DecodeSound(SoundId id);
+
+/// Adds a sound loaded with DecodeSound to the cache, which takes
+/// ownership of it.
+extern void AddSound(SoundId id, Mix_Chunk *chunk);
+
+extern bool HasTexture(TextureId id);
+extern bool HasSound(SoundId id);
+
+/// Returns the memory taken by textures (all mip levels), sounds or
+/// font atlases. Sounds are evicted like textures, except that they
+/// are held on to while playing rather than retained.
+extern MemoryUsage GetMemoryUsage(AssetType type);
+
+/// Prints the totals, then every cached item with its size.
+extern void PrintMemoryUsage();
+
+/// Once set, loading anything on first use is reported in debug
+/// builds, as it means the asset is missing from the manifest.
+extern bool preloadDone;
 
 } // namespace ResourceCache
 
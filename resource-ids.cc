@@ -0,0 +1,21 @@
+#include "resource-ids.hh"
+
+#define GRAVITY_RESOURCE_NAME(id, name) name,
+
+const char *TEXTURE_NAMES[] = {GRAVITY_TEXTURES(GRAVITY_RESOURCE_NAME)};
+const char *SOUND_NAMES[] = {GRAVITY_SOUNDS(GRAVITY_RESOURCE_NAME)};
+const char *FONT_NAMES[] = {GRAVITY_FONTS(GRAVITY_RESOURCE_NAME)};
+
+#undef GRAVITY_RESOURCE_NAME
+
+const char *GetResourceName(TextureId id) {
+  return TEXTURE_NAMES[(int) id];
+}
+
+const char *GetResourceName(SoundId id) {
+  return SOUND_NAMES[(int) id];
+}
+
+const char *GetResourceName(FontId id) {
+  return FONT_NAMES[(int) id];
+}
@@ -0,0 +1,79 @@
+#ifndef _GRAVITY_RESOURCE_IDS_HH_
+#define _GRAVITY_RESOURCE_IDS_HH_
+
+/// Every texture, sound and font the game uses, with the name of the
+/// file it is loaded from (for textures, the name of the texture
+/// variant). Everything else refers to resources by id, which the
+/// resource cache uses as an index into its arrays.
+///
+/// To add a resource, add a line to the list; the enum and the names
+/// are generated from it.
+
+#define GRAVITY_TEXTURES(X)                       \
+  X(BACKGROUND, "background")                     \
+  X(BACKGROUND_DARK, "background-dark")           \
+  X(CONTINUE, "continue")                         \
+  X(CREDITS, "credits")                           \
+  X(CREDITS_BUTTON, "credits-button")             \
+  X(DIGITS, "digits")                             \
+  X(END_GAME, "end-game")                         \
+  X(ENEMY, "enemy")                               \
+  X(EXIT, "exit")                                 \
+  X(GAME_OVER, "game-over")                       \
+  X(HIGH_SCORES, "high-scores")                   \
+  X(LIVES0, "lives0")                             \
+  X(LIVES1, "lives1")                             \
+  X(LIVES2, "lives2")                             \
+  X(LIVES3, "lives3")                             \
+  X(MAIN_MENU, "main-menu")                       \
+  X(MINUS_SCORE, "minus-score")                   \
+  X(MINUS_TIME, "minus-time")                     \
+  X(MUTE, "mute")                                 \
+  X(NEW_GAME, "new-game")                         \
+  X(PAUSE, "pause")                               \
+  X(PLUS_PLANET, "plus-planet")                   \
+  X(PLUS_SCORE, "plus-score")                     \
+  X(PLUS_TIME, "plus-time")                       \
+  X(SPLASH, "splash")                             \
+  X(SPLASH_DARK, "splash-dark")                   \
+  X(UNMUTE, "unmute")
+
+#define GRAVITY_SOUNDS(X)                         \
+  X(BROWN, "brown")                               \
+  X(CLICK, "button-click")                        \
+  X(ENEMY_COLLISION, "enemy-collision")           \
+  X(HOVER, "mouse-over")                          \
+  X(PLANET_POWERUP, "planet-powerup")             \
+  X(PLANET_SUN_COLLISION, "planet-sun-collision") \
+  X(SCORE_TIK, "score-tik")                       \
+  X(SUN_POWERUP, "sun-powerup")
+
+#define GRAVITY_FONTS(X)                          \
+  X(KENVECTOR_FUTURE, "kenvector_future")
+
+#define GRAVITY_RESOURCE_ID(id, name) id,
+
+enum class TextureId {
+  GRAVITY_TEXTURES(GRAVITY_RESOURCE_ID)
+  COUNT
+};
+
+enum class SoundId {
+  GRAVITY_SOUNDS(GRAVITY_RESOURCE_ID)
+  COUNT
+};
+
+enum class FontId {
+  GRAVITY_FONTS(GRAVITY_RESOURCE_ID)
+  COUNT
+};
+
+#undef GRAVITY_RESOURCE_ID
+
+/// Returns the file name of a resource, without directory or
+/// extension.
+extern const char *GetResourceName(TextureId id);
+extern const char *GetResourceName(SoundId id);
+extern const char *GetResourceName(FontId id);
+
+#endif /* _GRAVITY_RESOURCE_IDS_HH_ */
@@ -0,0 +1,44 @@
+#version 330
+
+in VERTEX {
+  vec2 local;
+  float ring;
+  float glow;
+  float softness;
+  vec4 fill_color;
+  vec4 edge_color;
+} vertex;
+
+out vec4 output_color;
+
+void main() {
+  // Signed distance from the edge of the disk, in units of radius:
+  // negative inside, positive outside.
+  float dist = length(vertex.local) - 1.0;
+
+  // The size of a pixel in the same units, so the antialiasing is
+  // always about one pixel wide whatever the zoom or resolution.
+  float aa = fwidth(dist);
+
+  // Disk coverage, with a soft border if requested.
+  float border = max(vertex.softness, aa);
+  float coverage = 1.0 - smoothstep(-border, 0.0, dist - 0.5 * aa);
+
+  // Blend into the edge color across the ring.
+  vec4 disk = vertex.fill_color;
+  if (vertex.ring > 0.0)
+    disk = mix(disk, vertex.edge_color, smoothstep(-vertex.ring - aa, -vertex.ring + aa, dist));
+  disk.a *= coverage;
+
+  // Glow fading out quadratically beyond the edge.
+  float glow = 0.0;
+  if (vertex.glow > 0.0) {
+    float g = 1.0 - clamp(dist / vertex.glow, 0.0, 1.0);
+    glow = vertex.edge_color.a * g * g;
+  }
+
+  // Composite the disk over the glow.
+  float alpha = disk.a + glow * (1.0 - disk.a);
+  vec3 color = disk.rgb * disk.a + vertex.edge_color.rgb * glow * (1.0 - disk.a);
+  output_color = vec4(color / max(alpha, 0.0001), alpha);
+}
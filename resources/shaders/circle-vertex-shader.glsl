@@ -0,0 +1,50 @@
+#version 330
+
+// Shared by all programs and updated once per frame by the
+// renderer. The layout must match ViewUniforms in renderer.hh.
+layout(std140) uniform View {
+  vec2 resolution;
+  vec2 camera_pos;
+  float ppm;
+};
+
+/// Corner of the quad, in [-1, 1].
+in vec2 corner;
+
+/// Per-instance parameters; see CircleStyle in circle.hh.
+in vec2 center;
+in float radius;
+in float ring;
+in float glow;
+in float softness;
+in vec4 fill_color;
+in vec4 edge_color;
+
+out VERTEX {
+  vec2 local;
+  float ring;
+  float glow;
+  float softness;
+  vec4 fill_color;
+  vec4 edge_color;
+} vertex;
+
+void main() {
+  // The quad is made large enough to contain the glow.
+  float extent = 1.0 + glow;
+
+  // Position relative to the center, in units of radius.
+  vertex.local = corner * extent;
+
+  vec2 coord = center + vertex.local * radius;
+  coord -= camera_pos;
+  coord *= ppm;
+  coord = coord / resolution * 2.0 - 1.0;
+
+  vertex.ring = ring;
+  vertex.glow = glow;
+  vertex.softness = softness;
+  vertex.fill_color = fill_color;
+  vertex.edge_color = edge_color;
+  gl_Position = vec4(coord, 0.0, 1.0);
+}
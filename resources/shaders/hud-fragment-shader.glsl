@@ -0,0 +1,15 @@
+#version 330
+
+uniform sampler2D texture0;
+
+in VERTEX {
+  vec2 tex_coord;
+  vec4 color;
+} vertex;
+
+out vec4 output_color;
+
+void main() {
+  // Sample the atlas and mix the result with the color.
+  output_color = texture(texture0, vertex.tex_coord) * vertex.color;
+}
@@ -0,0 +1,23 @@
+#version 330
+
+/// Vertex position in normalized device coordinates. The HUD layer
+/// lays out the widgets on the CPU, so there is nothing left to do
+/// here.
+in vec2 coord;
+
+/// Texture coordinates in the HUD atlas.
+in vec2 tex_coord;
+
+/// The color mixed with the texture.
+in vec4 color;
+
+out VERTEX {
+  vec2 tex_coord;
+  vec4 color;
+} vertex;
+
+void main() {
+  vertex.tex_coord = tex_coord;
+  vertex.color = color;
+  gl_Position = vec4(coord, 0.0, 1.0);
+}
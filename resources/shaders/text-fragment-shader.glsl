@@ -10,6 +10,7 @@ in VERTEX {
 out vec4 output_color;
 
 void main() {
+  // The glyph atlas only has a red channel, holding the coverage.
   output_color = vec4(vertex.color.rgb,
-                      texture(texture0, vertex.tex_coord).a * vertex.color.a);
+                      texture(texture0, vertex.tex_coord).r * vertex.color.a);
 }
@@ -0,0 +1,179 @@
+#include "screen-manager.hh"
+#include "splash-screen.hh"
+#include "main-menu-screen.hh"
+#include "game-screen.hh"
+#include "high-scores-screen.hh"
+#include "credits-screen.hh"
+#include "startup-profile.hh"
+
+#include <fstream>
+#include <iostream>
+
+ScreenManager::ScreenManager(SDL_Window *window, const string &savefile) :
+  window(window),
+  savefile(savefile),
+  timeScale(0.0)
+{
+  for (auto &s : this->screens)
+    s = nullptr;
+
+  this->stack.push_back(ScreenId::SPLASH);
+  this->Get(ScreenId::SPLASH);
+}
+
+ScreenManager::~ScreenManager() {
+  for (int i = 0; i < (int) ScreenId::COUNT; ++i)
+    this->Release((ScreenId) i);
+}
+
+void ScreenManager::SetTimeScale(float scale) {
+  this->timeScale = scale;
+
+  GameScreen *game = static_cast<GameScreen*>(this->screens[(int) ScreenId::GAME]);
+  if (game && scale > 0.0)
+    game->SetTimeScale(scale);
+}
+
+Screen *ScreenManager::Get(ScreenId id) {
+  Screen *&screen = this->screens[(int) id];
+  if (screen == nullptr)
+    screen = this->Create(id);
+  return screen;
+}
+
+Screen *ScreenManager::Create(ScreenId id) {
+  switch (id) {
+  case ScreenId::SPLASH:
+    return new SplashScreen(this->window);
+
+  case ScreenId::MAIN_MENU:
+    return new MainMenuScreen(this->window);
+
+  case ScreenId::GAME: {
+    GameScreen *game = new GameScreen(this->window);
+    if (this->timeScale > 0.0)
+      game->SetTimeScale(this->timeScale);
+    return game;
+  }
+
+  case ScreenId::HIGH_SCORES: {
+    Screen *highScores = new HighScoresScreen(this->window);
+    ifstream input(this->savefile, ifstream::in | ifstream::binary);
+    if (input)
+      highScores->Load(input);
+    else
+      cout << "No save file." << endl;
+    return highScores;
+  }
+
+  case ScreenId::CREDITS:
+    return new CreditsScreen(this->window);
+
+  default:
+    return nullptr;
+  }
+}
+
+void ScreenManager::Release(ScreenId id) {
+  Screen *&screen = this->screens[(int) id];
+  if (screen == nullptr)
+    return;
+
+  // The high scores only live in the screen, so they are saved before
+  // it goes away.
+  if (id == ScreenId::HIGH_SCORES) {
+    ofstream output(this->savefile, ofstream::out | ofstream::binary);
+    if (output) {
+      screen->Save(output);
+    }
+    else {
+#ifndef RELEASE_BUILD
+      cout << "Could not write to save file." << endl;
+#endif
+    }
+  }
+
+  delete screen;
+  screen = nullptr;
+}
+
+Screen *ScreenManager::GetCurrent() const {
+  return this->screens[(int) this->stack.back()];
+}
+
+ScreenId ScreenManager::GetCurrentId() const {
+  return this->stack.back();
+}
+
+void ScreenManager::Push(ScreenId id, const Transition &from) {
+  this->stack.push_back(id);
+
+  Screen *screen = this->Get(id);
+  screen->SwitchScreen(from);
+  screen->RequestRedraw();
+}
+
+void ScreenManager::Replace(ScreenId id, const Transition &from) {
+  ScreenId last = this->stack.back();
+  this->stack.pop_back();
+  this->Push(id, from);
+  this->Release(last);
+}
+
+void ScreenManager::Pop(const Transition &from) {
+  this->Release(this->stack.back());
+  this->stack.pop_back();
+
+  Screen *screen = this->GetCurrent();
+  screen->SwitchScreen(from);
+  screen->RequestRedraw();
+}
+
+bool ScreenManager::Update() {
+  Transition t = this->GetCurrent()->TakeTransition();
+
+  switch (t.type) {
+  case TransitionType::NONE:
+    break;
+
+  case TransitionType::LOADING_DONE:
+    StartupProfile::Mark("asset-loading");
+    this->Replace(ScreenId::MAIN_MENU, t);
+    StartupProfile::Mark("main-menu");
+    break;
+
+  case TransitionType::NEW_GAME:
+    this->Get(ScreenId::GAME)->Reset();
+    this->Push(ScreenId::GAME, t);
+    break;
+
+  case TransitionType::GAME_OVER:
+    this->Replace(ScreenId::HIGH_SCORES, t);
+    break;
+
+  case TransitionType::SHOW_HIGH_SCORES:
+    this->Push(ScreenId::HIGH_SCORES, t);
+    break;
+
+  case TransitionType::SHOW_CREDITS:
+    this->Push(ScreenId::CREDITS, t);
+    break;
+
+  case TransitionType::BACK:
+    if (this->stack.size() == 1)
+      return false;
+    this->Pop(t);
+    break;
+
+  case TransitionType::EXIT:
+    return false;
+  }
+
+  return true;
+}
+
+void ScreenManager::Prefetch() {
+  // New Game is the common way out of the main menu.
+  if (this->GetCurrentId() == ScreenId::MAIN_MENU)
+    this->Get(ScreenId::GAME);
+}
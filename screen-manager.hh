@@ -0,0 +1,58 @@
+#ifndef _GRAVITY_SCREEN_MANAGER_HH_
+#define _GRAVITY_SCREEN_MANAGER_HH_
+
+#include "screen.hh"
+
+#include <SDL2/SDL.h>
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/// Owns the screens and moves between them. Screens are kept on a
+/// stack: the main menu stays at the bottom, and the screens opened
+/// from it are pushed on top and popped when the player goes back.
+///
+/// A screen is only constructed when it is first shown, or prefetched
+/// while the screen before it sits idle. Screens are deleted, along
+/// with their textures and buffers, once they leave the stack.
+class ScreenManager {
+protected:
+  SDL_Window *window;
+  string savefile;
+  float timeScale;
+
+  Screen *screens[(int) ScreenId::COUNT];
+  vector<ScreenId> stack;
+
+  Screen *Get(ScreenId id);
+  Screen *Create(ScreenId id);
+  void Release(ScreenId id);
+
+  void Push(ScreenId id, const Transition &from);
+  void Replace(ScreenId id, const Transition &from);
+  void Pop(const Transition &from);
+
+public:
+  /// Starts with the splash screen. The high scores are read from and
+  /// written to `savefile`.
+  ScreenManager(SDL_Window *window, const string &savefile);
+  ~ScreenManager();
+
+  /// Makes the game screens run `scale` times faster than real time.
+  void SetTimeScale(float scale);
+
+  Screen *GetCurrent() const;
+  ScreenId GetCurrentId() const;
+
+  /// Carries out the transition the current screen has asked for, if
+  /// any. Returns false when the game should quit.
+  bool Update();
+
+  /// Constructs the screen most likely to be shown next, if it does not
+  /// exist yet. Meant to be called while the current screen is idle.
+  void Prefetch();
+};
+
+#endif /* _GRAVITY_SCREEN_MANAGER_HH_ */
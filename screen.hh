@@ -3,6 +3,7 @@
 
 #include "widget.hh"
 #include "renderer.hh"
+#include "hud-layer.hh"
 
 #include <SDL2/SDL.h>
 
@@ -12,13 +13,58 @@
 
 using namespace std;
 
+/// The screens of the game, as known to the ScreenManager.
+enum class ScreenId {
+  SPLASH,
+  MAIN_MENU,
+  GAME,
+  HIGH_SCORES,
+  CREDITS,
+  COUNT
+};
+
+/// What a screen asks for when the player is done with it.
+enum class TransitionType {
+  NONE,
+  LOADING_DONE,
+  NEW_GAME,
+  GAME_OVER,
+  SHOW_HIGH_SCORES,
+  SHOW_CREDITS,
+  BACK,
+  EXIT
+};
+
+/// The outcome of a game, handed over to the high scores.
+struct GameResult {
+  int score;
+};
+
+struct Transition {
+  TransitionType type;
+
+  /// Only set with GAME_OVER.
+  GameResult result;
+};
+
 class Screen {
 protected:
   vector<Widget*> widgets;
+  bool redrawRequested;
+  Transition transition;
+
+  /// Asks to leave the screen. The request is carried out by the
+  /// ScreenManager at the end of the frame.
+  void Finish(TransitionType type, GameResult result = {0}) {
+    this->transition = {type, result};
+  }
 
 public:
   Screen(SDL_Window *window) :
-    window(window)
+    redrawRequested(true),
+    transition({TransitionType::NONE, {0}}),
+    window(window),
+    hud(window)
   {}
 
   virtual ~Screen() {
@@ -27,9 +73,11 @@ public:
   }
 
   SDL_Window *window;
-  map<string, string> state;
+  HudLayer hud;
 
-  virtual void SwitchScreen(const map<string, string> &lastState) = 0;
+  /// Called when the screen is shown, with the transition that led to
+  /// it.
+  virtual void SwitchScreen(const Transition &from) = 0;
   virtual void HandleEvent(const SDL_Event &e) = 0;
   virtual void HandleWidgetEvent(int event_type, Widget *widget) {}
 
@@ -39,6 +87,42 @@ public:
 
   virtual void Advance(float dt) = 0;
   virtual void Render(Renderer *renderer) = 0;
+
+  /// Returns true if the screen changes on its own (physics,
+  /// animations, loading) and so has to be advanced and drawn on every
+  /// frame. Other screens are only drawn when something has changed.
+  virtual bool IsAnimating() const {
+    return false;
+  }
+
+  /// Asks for the screen to be drawn in the next frame, even if it is
+  /// not animating.
+  void RequestRedraw() {
+    this->redrawRequested = true;
+  }
+
+  /// Returns true if the screen has to be drawn in the next frame.
+  bool NeedsRedraw() const {
+    return this->redrawRequested || this->IsAnimating() || this->hud.NeedsRedraw();
+  }
+
+  /// Called after the screen has been drawn.
+  void RedrawDone() {
+    this->redrawRequested = false;
+  }
+
+  /// Returns the transition asked for since the last call, if any,
+  /// and clears it.
+  Transition TakeTransition() {
+    Transition t = this->transition;
+    this->transition.type = TransitionType::NONE;
+    return t;
+  }
+
+  /// Draws the widgets through the HUD layer.
+  void RenderWidgets(Renderer *renderer) {
+    this->hud.Render(this->widgets);
+  }
 };
 
 #endif /* _GRAVITY_SCREEN_HH_ */
@@ -0,0 +1,107 @@
+#include "screenshot-writer.hh"
+#include "platform.hh"
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "stb_image_write.h"
+
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+ScreenshotWriter::ScreenshotWriter(const string &directory) :
+  directory(directory),
+  directoryCreated(false),
+  stopping(false)
+{
+  this->worker = thread(&ScreenshotWriter::Run, this);
+}
+
+ScreenshotWriter::~ScreenshotWriter() {
+  {
+    lock_guard<mutex> lock(this->queueMutex);
+    this->stopping = true;
+  }
+  this->queueCondition.notify_one();
+  this->worker.join();
+}
+
+void ScreenshotWriter::Save(PixelImage &&image) {
+  {
+    lock_guard<mutex> lock(this->queueMutex);
+    this->queue.push_back(move(image));
+  }
+  this->queueCondition.notify_one();
+}
+
+void ScreenshotWriter::Run() {
+  for (;;) {
+    unique_lock<mutex> lock(this->queueMutex);
+    this->queueCondition.wait(lock, [this] { return this->stopping || !this->queue.empty(); });
+
+    // Only stop once everything queued has been written.
+    if (this->queue.empty())
+      return;
+
+    PixelImage image = move(this->queue.front());
+    this->queue.pop_front();
+    lock.unlock();
+
+    this->Write(image);
+  }
+}
+
+string ScreenshotWriter::MakeFilename() const {
+  char timestamp[32];
+  time_t now = time(nullptr);
+  strftime(timestamp, sizeof(timestamp), "%Y%m%d-%H%M%S", localtime(&now));
+
+  // Add a counter for screenshots taken within the same second.
+  for (int i = 1; ; ++i) {
+    stringstream ss;
+    ss << this->directory << "/gravity-" << timestamp;
+    if (i > 1)
+      ss << "-" << i;
+    ss << ".png";
+
+    if (!ifstream(ss.str()))
+      return ss.str();
+  }
+}
+
+void ScreenshotWriter::Write(PixelImage &image) {
+  if (!this->directoryCreated) {
+    if (!MakeDirectory(this->directory)) {
+      cout << "Could not create screenshot directory " << this->directory << endl;
+      return;
+    }
+    this->directoryCreated = true;
+  }
+
+  // Whatever alpha ended up in the window is meaningless; make the
+  // image opaque.
+  for (size_t i = 3; i < image.pixels.size(); i += 4)
+    image.pixels[i] = 255;
+
+  string filename = this->MakeFilename();
+  string tmpFilename = filename + ".tmp";
+
+  // The rows are bottom first. Rather than flipping them, start at the
+  // last row and let the encoder step backwards through the image.
+  int rowSize = image.width * 4;
+  const uint8_t *lastRow = image.pixels.data() + (size_t) (image.height - 1) * rowSize;
+  if (!stbi_write_png(tmpFilename.data(), image.width, image.height, 4, lastRow, -rowSize)) {
+    cout << "Could not write screenshot to " << tmpFilename << endl;
+    remove(tmpFilename.data());
+    return;
+  }
+
+  if (rename(tmpFilename.data(), filename.data()) != 0) {
+    cout << "Could not rename " << tmpFilename << " to " << filename << endl;
+    remove(tmpFilename.data());
+    return;
+  }
+
+  cout << "Saved screenshot to " << filename << endl;
+}
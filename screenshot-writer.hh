@@ -0,0 +1,43 @@
+#ifndef _GRAVITY_SCREENSHOT_WRITER_HH_
+#define _GRAVITY_SCREENSHOT_WRITER_HH_
+
+#include "pixel-readback.hh"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+using namespace std;
+
+/// Encodes screenshots to PNG files on a worker thread, so that the
+/// main loop only has to hand the pixels over. Files are written under
+/// a temporary name and renamed once complete, so a partially written
+/// screenshot is never seen under its final name.
+class ScreenshotWriter {
+protected:
+  string directory;
+  bool directoryCreated;
+
+  deque<PixelImage> queue;
+  bool stopping;
+  mutex queueMutex;
+  condition_variable queueCondition;
+  thread worker;
+
+  void Run();
+  void Write(PixelImage &image);
+  string MakeFilename() const;
+
+public:
+  /// The directory is created when the first screenshot is written.
+  ScreenshotWriter(const string &directory);
+
+  /// Waits for the screenshots still queued to be written.
+  ~ScreenshotWriter();
+
+  void Save(PixelImage &&image);
+};
+
+#endif /* _GRAVITY_SCREENSHOT_WRITER_HH_ */
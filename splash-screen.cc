@@ -1,17 +1,28 @@
 #include "splash-screen.hh"
 #include "resource-cache.hh"
+#include "config.hh"
+
+#include <sstream>
 
 SplashScreen::SplashScreen(SDL_Window *window) :
   Screen(window),
-  background(window, ResourceCache::GetTexture("splash"))
+  background(window, ResourceCache::GetTexture(TextureId::SPLASH_DARK))
 {
+  this->progressLabel = new LabelWidget(this,
+                                        "LOADING 0%",
+                                        0.0, 0.05, 0.05,
+                                        TextAnchor::CENTER, TextAnchor::BOTTOM,
+                                        {255, 255, 255, 160});
+  this->widgets.push_back(this->progressLabel);
+
+  this->loader = new AssetLoader(window, AssetManifest::GetAll());
 }
 
 SplashScreen::~SplashScreen() {
-
+  delete this->loader;
 }
 
-void SplashScreen::SwitchScreen(const map<string, string> &lastState) {
+void SplashScreen::SwitchScreen(const Transition &from) {
 
 }
 
@@ -32,60 +43,20 @@ void SplashScreen::Load(istream &s) {
 }
 
 void SplashScreen::Advance(float dt) {
-  static int n = 0;
-
-  switch (n) {
-  case 0:
-    ResourceCache::GetTexture("background");
-    break;
-  case 1:
-    ResourceCache::GetTexture("sun");
-    break;
-  case 2:
-    ResourceCache::GetTexture("planet");
-    break;
-  case 3:
-    ResourceCache::GetTexture("trail-point");
-    break;
-  case 4:
-    ResourceCache::GetTexture("plus-score");
-    break;
-  case 5:
-    ResourceCache::GetTexture("minus-score");
-    break;
-  case 6:
-    ResourceCache::GetTexture("plus-time");
-    break;
-  case 7:
-    ResourceCache::GetTexture("minus-time");
-    break;
-  case 8:
-    ResourceCache::GetTexture("plus-planet");
-    break;
-  case 9:
-    ResourceCache::GetTexture("enemy");
-    break;
-  case 10:
-    ResourceCache::GetTexture("pause");
-    break;
-  case 11:
-    ResourceCache::GetTexture("new-game");
-    break;
-  case 12:
-    ResourceCache::GetTexture("high-scores");
-    break;
-  case 13:
-    ResourceCache::GetTexture("exit");
-    break;
-  default:
-    this->state["name"] = "splash-over";
-    break;
-  }
-
-  ++n;
+  // Leave most of the frame for drawing, so that the progress keeps
+  // being shown while loading.
+  this->loader->Update(Config::LoadingFrameBudget);
+
+  stringstream ss;
+  ss << "LOADING " << (int) (this->loader->GetProgress() * 100) << "%";
+  this->progressLabel->SetText(ss.str());
+
+  if (this->loader->IsDone())
+    this->Finish(TransitionType::LOADING_DONE);
 }
 
 void SplashScreen::Render(Renderer *renderer) {
   this->background.Draw();
+  this->RenderWidgets(renderer);
   renderer->PresentScreen();
 }
@@ -2,15 +2,20 @@
 #define _GRAVITY_SPLASH_HH_
 
 #include "screen.hh"
+#include "asset-loader.hh"
+#include "label-widget.hh"
 
 class SplashScreen : public Screen {
 protected:
   Background background;
+  AssetLoader *loader;
+  LabelWidget *progressLabel;
+
 public:
   SplashScreen(SDL_Window *window);
   virtual ~SplashScreen();
 
-  virtual void SwitchScreen(const map<string, string> &lastState);
+  virtual void SwitchScreen(const Transition &from);
   virtual void HandleEvent(const SDL_Event &e);
 
   virtual void Reset();
@@ -19,6 +24,9 @@ public:
 
   virtual void Advance(float dt);
   virtual void Render(Renderer *renderer);
+
+  // Loads resources on every frame until done.
+  virtual bool IsAnimating() const { return true; }
 };
 
 #endif /* _GRAVITY_SPLASH_HH_ */
@@ -0,0 +1,61 @@
+#include "startup-profile.hh"
+
+#include <SDL2/SDL.h>
+
+#include <iomanip>
+#include <vector>
+
+namespace StartupProfile {
+
+struct Phase {
+  string name;
+  Uint64 end;
+};
+
+// Taken while static objects are constructed, which is as close to
+// the start of the process as the game can portably get.
+Uint64 startTicks = SDL_GetPerformanceCounter();
+
+vector<Phase> phases;
+
+double ToMilliseconds(Uint64 ticks) {
+  return ticks * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
+void Mark(const string &phase) {
+  phases.push_back({phase, SDL_GetPerformanceCounter()});
+}
+
+void Report(ostream &out, bool json) {
+  Uint64 last = startTicks;
+  double total = phases.empty() ? 0.0 : ToMilliseconds(phases.back().end - startTicks);
+
+  ios::fmtflags flags = out.flags();
+  out << fixed << setprecision(2);
+
+  if (json) {
+    out << "{\"total_ms\": " << total << ", \"phases\": [";
+    for (size_t i = 0; i < phases.size(); ++i) {
+      out << (i > 0 ? ", " : "")
+          << "{\"name\": \"" << phases[i].name << "\", "
+          << "\"ms\": " << ToMilliseconds(phases[i].end - last) << "}";
+      last = phases[i].end;
+    }
+    out << "]}" << endl;
+  }
+  else {
+    out << "Startup: " << total << " ms" << endl;
+    for (auto &p : phases) {
+      double ms = ToMilliseconds(p.end - last);
+      out << "  " << left << setw(20) << p.name << right
+          << setw(10) << ms << " ms"
+          << setw(8) << setprecision(1) << (total > 0.0 ? ms * 100.0 / total : 0.0) << "%"
+          << setprecision(2) << endl;
+      last = p.end;
+    }
+  }
+
+  out.flags(flags);
+}
+
+} // namespace StartupProfile
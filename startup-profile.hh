@@ -0,0 +1,23 @@
+#ifndef _GRAVITY_STARTUP_PROFILE_HH_
+#define _GRAVITY_STARTUP_PROFILE_HH_
+
+#include <ostream>
+#include <string>
+
+using namespace std;
+
+/// Timestamps the phases of startup with the high-resolution
+/// performance counter. Each mark ends a phase; the phase lasts from the
+/// previous mark, or from when the program was loaded for the first
+/// one. Marking is cheap enough to stay in every build, and nothing is
+/// printed unless a report is asked for.
+namespace StartupProfile {
+
+void Mark(const string &phase);
+
+/// Writes the time spent in each phase, as a table or as JSON.
+void Report(ostream &out, bool json);
+
+} // namespace StartupProfile
+
+#endif /* _GRAVITY_STARTUP_PROFILE_HH_ */
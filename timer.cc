@@ -2,8 +2,22 @@
 
 #include <iostream>
 #include <algorithm>
+#include <cmath>
 
 vector<Timer*> Timer::timers;
+float Timer::timeScale = 1.0;
+Uint32 Timer::clockBase = 0;
+Uint32 Timer::clockStart = 0;
+
+Uint32 Timer::Now() {
+  return clockBase + (Uint32) ((SDL_GetTicks() - clockStart) * timeScale);
+}
+
+void Timer::SetTimeScale(float scale) {
+  clockBase = Now();
+  clockStart = SDL_GetTicks();
+  timeScale = scale;
+}
 
 Timer::Timer(timer_callback callback) :
   callback(callback),
@@ -17,31 +31,54 @@ Timer::~Timer() {
 }
 
 void Timer::Set(float timeout, bool periodic) {
-  this->startTime = SDL_GetTicks();
+  this->startTime = Now();
   this->timeout = timeout;
   this->periodic = periodic;
   this->expired = false;
 }
 
+void Timer::Stop() {
+  this->expired = true;
+}
+
 void Timer::Check() {
   if (this->expired || this->paused)
     return;
 
-  float elapsed = (SDL_GetTicks() - this->startTime) / 1000.0;
-  if (elapsed >= this->timeout) {
-    if (this->periodic)
-      this->startTime = SDL_GetTicks();
+  Uint32 now = Now();
+  float elapsed = (now - this->startTime) / 1000.0;
+  if (elapsed < this->timeout)
+    return;
+
+  if (!this->periodic) {
+    this->expired = true;
+    this->callback(elapsed / timeScale);
+    return;
+  }
 
-    this->callback(elapsed);
-    this->expired = !this->periodic;
+  // When running faster than real time, several periods may pass
+  // between two checks; fire once for each of them. Never fire more
+  // often than the time scale calls for though, so that a stall is not
+  // followed by a burst of callbacks.
+  int periods = elapsed / this->timeout;
+  int maxPeriods = max(1, (int) ceil(timeScale));
+  if (periods > maxPeriods) {
+    periods = maxPeriods;
+    this->startTime = now;
   }
+  else
+    this->startTime += periods * this->timeout * 1000;
+
+  float realElapsed = elapsed / timeScale / periods;
+  for (int i = 0; i < periods && !this->expired && !this->paused; ++i)
+    this->callback(realElapsed);
 }
 
 void Timer::Pause() {
   if (expired)
     return;
 
-  this->pauseTime = SDL_GetTicks();
+  this->pauseTime = Now();
   this->paused = true;
 }
 
@@ -50,7 +87,7 @@ void Timer::Unpause() {
     return;
 
   if (this->paused)
-    this->startTime += SDL_GetTicks() - this->pauseTime;
+    this->startTime += Now() - this->pauseTime;
 
   this->paused = false;
 }
@@ -10,6 +10,9 @@ using namespace std;
 
 class Timer {
 protected:
+  // Called with the real time, in seconds, that the firing stands for.
+  // A periodic timer firing several times in one check shares the time
+  // out between the calls.
   typedef function<void (float elapsed)> timer_callback;
 
   Uint32 startTime;
@@ -25,11 +28,22 @@ protected:
 
   static vector<Timer*> timers;
 
+  // The clock all timers run on. It follows SDL_GetTicks, sped up or
+  // slowed down by the time scale.
+  static float timeScale;
+  static Uint32 clockBase;
+  static Uint32 clockStart;
+
+  static Uint32 Now();
+
 public:
   Timer(timer_callback callback);
   virtual ~Timer();
 
   void Set(float timeout, bool periodic=false);
+
+  /// Keeps the timer from firing again until it is Set.
+  void Stop();
   void Check();
   void Pause();
   void Unpause();
@@ -40,6 +54,9 @@ public:
   static void PauseAll();
   static void UnpauseAll();
   static void TogglePauseAll();
+
+  /// Makes all timers run `scale` times faster than real time.
+  static void SetTimeScale(float scale);
 };
 
 #endif /* _GRAVITY_TIMER_HH_ */
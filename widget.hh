@@ -2,6 +2,7 @@
 #define _GRAVITY_WIDGET_HH_
 
 #include "renderer.hh"
+#include "hud-layer.hh"
 
 #include <SDL2/SDL.h>
 
@@ -18,17 +19,30 @@ public:
     visible(true)
   {}
 
+  virtual ~Widget() {}
+
   void SetVisible(bool v) {
-    this->visible = v;
+    if (v != this->visible) {
+      this->visible = v;
+      this->Invalidate();
+    }
   }
 
   bool GetVisible() const {
     return this->visible;
   }
 
+  /// Tells the screen's HUD layer that the widget has changed and the
+  /// layout needs to be redone.
+  void Invalidate();
+
   virtual void HandleEvent(const SDL_Event &e) = 0;
   virtual void Advance(float dt) = 0;
-  virtual void Render(Renderer *renderer) = 0;
+
+  /// Adds the quads of the widget to the HUD layer. Called whenever
+  /// the layer is laid out again, for invisible widgets too so that
+  /// they can keep their hit-testing rectangles up to date.
+  virtual void Layout(HudLayer *hud) = 0;
   virtual void Reset() = 0;
 };
 
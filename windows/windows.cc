@@ -1,6 +1,7 @@
 #include <string>
 #include <sstream>
 #include <iostream>
+#include <cstdio>
 
 #include <windows.h>
 #include <shlobj.h>
@@ -16,6 +17,55 @@ string GetUserHomeDirectory() {
     return ".";
 }
 
+string GetUserCacheDirectory() {
+  // Local application data is not roamed, so it is already meant for
+  // things like caches.
+  return GetUserHomeDirectory();
+}
+
 void ShowMessage(string msg) {
   MessageBox(0, msg.data(), "Gravity", MB_OK);
 }
+
+bool MakeDirectory(const string &path) {
+  return CreateDirectory(path.data(), NULL) || GetLastError() == ERROR_ALREADY_EXISTS;
+}
+
+FILE *OpenOutputPipe(const string &command) {
+  return _popen(command.data(), "wb");
+}
+
+int CloseOutputPipe(FILE *pipe) {
+  return _pclose(pipe);
+}
+
+const void *MapFile(const string &path, size_t &size) {
+  HANDLE file = CreateFile(path.data(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                           OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file == INVALID_HANDLE_VALUE)
+    return nullptr;
+
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+    CloseHandle(file);
+    return nullptr;
+  }
+
+  HANDLE mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  CloseHandle(file);
+  if (mapping == NULL)
+    return nullptr;
+
+  // The view stays valid after both handles are closed.
+  const void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);
+  if (data == NULL)
+    return nullptr;
+
+  size = fileSize.QuadPart;
+  return data;
+}
+
+void UnmapFile(const void *data, size_t size) {
+  UnmapViewOfFile(data);
+}